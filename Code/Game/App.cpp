@@ -1,5 +1,8 @@
 ﻿#include "Game/App.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Engine/Window/Window.hpp"
 #include "Game.hpp"
 #include "Engine/Audio/AudioSubsystem.hpp"
@@ -27,6 +30,7 @@
 // MessageLog system integration
 #include "Engine/Core/MessageLog/MessageLogSubsystem.hpp"
 #include "Engine/Core/MessageLog/MessageLogAppender.hpp"
+#include "Game/Framework/MessageLogEngineAppender.hpp"
 
 // ImGui system integration
 #include "Engine/Core/ImGui/ImGuiSubsystem.hpp"
@@ -39,13 +43,61 @@
 #include "Test/Test_AtlasSystem.hpp"
 #include "Engine/Resource/Atlas/ImageLoader.hpp"
 
-Window*                g_theWindow   = nullptr;
-IRenderer*             g_theRenderer = nullptr;
-App*                   g_theApp      = nullptr;
-RandomNumberGenerator* g_rng         = nullptr;
-InputSystem*           g_theInput    = nullptr;
-AudioSubsystem*        g_theAudio    = nullptr;
-Game*                  g_theGame     = nullptr;
+// Typed config blackboard
+#include "Game/Framework/TypedBlackboard.hpp"
+#include "Test/Test_ConfigBlackboard.hpp"
+
+// Typed event bus
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/GameEvents.hpp"
+#include "Test/Test_GameEventBus.hpp"
+#include "Test/Test_MpscRingQueue.hpp"
+
+// Render submission seam
+#include "Game/Render/EngineRenderDevice.hpp"
+#include "Test/Test_HeadlessRender.hpp"
+#include "Test/Test_DebugShapes.hpp"
+#include "Test/Test_DebugText.hpp"
+#include "Test/Test_FrustumCulling.hpp"
+#include "Test/Test_Transform.hpp"
+#include "Test/Test_EntityStore.hpp"
+#include "Test/Test_Collision.hpp"
+
+// Job system
+#include "Game/Framework/JobSystem.hpp"
+#include "Test/Test_JobSystem.hpp"
+
+// Game-lifetime arena
+#include "Game/Framework/GameArena.hpp"
+#include "Test/Test_GameArena.hpp"
+#include "Test/Test_IndexedMesh.hpp"
+
+// Pipelined render
+#include "Game/Render/RenderPipeline.hpp"
+#include "Test/Test_RenderPipeline.hpp"
+#include "Test/Test_RenderCommandQueue.hpp"
+
+// CPU profiler
+#include "Game/Framework/Profiler.hpp"
+#include "Test/Test_Profiler.hpp"
+
+// Tagged memory tracking
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Test/Test_MemoryTracker.hpp"
+
+Window*                g_theWindow       = nullptr;
+IRenderer*             g_theRenderer     = nullptr;
+App*                   g_theApp          = nullptr;
+RandomNumberGenerator* g_rng             = nullptr;
+InputSystem*           g_theInput        = nullptr;
+AudioSubsystem*        g_theAudio        = nullptr;
+Game*                  g_theGame         = nullptr;
+TypedBlackboard        g_gameConfig;
+GameEventBus*          g_theEventBus     = nullptr;
+RenderDevice*          g_theRenderDevice = nullptr;
+JobSystem*             g_theJobSystem    = nullptr;
+GameArena*             g_theGameArena    = nullptr;
+Profiler*              g_theProfiler     = nullptr;
 
 App::App()
 {
@@ -61,16 +113,28 @@ void App::Startup(char*)
 {
     using namespace enigma::resource;
 
+    // First, so every startup phase lands in the startup capture
+    g_theProfiler = new Profiler();
+    PROFILE_SCOPE("App::Startup");
+
     // Load Game Config
     LoadGameConfig(".enigma/config/GameConfig.xml");
+    m_exportStartupTrace  = g_gameConfig.GetValue(CONFIG_EXPORT_STARTUP_TRACE, false);
     m_consoleSpace.m_mins = Vec2::ZERO;
-    m_consoleSpace.m_maxs = Vec2(g_gameConfigBlackboard.GetValue("screenSizeX", 1600.f), g_gameConfigBlackboard.GetValue("screenSizeY", 800.f));
+    m_consoleSpace.m_maxs = Vec2(g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_X, 1600.f), g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_Y, 800.f));
+    m_fixedDeltaSeconds   = GetFixedDeltaSeconds();
+    m_maxSimulationSteps  = std::max(g_gameConfig.GetValue(CONFIG_MAX_SIMULATION_STEPS, 5), 1);
 
+    // Each phase below charges its heap allocations to the subsystem it builds, the rest to Engine
+    MEMORY_TAG_SCOPE(MemoryTag::Engine);
     EventSystemConfig eventSystemConfig;
     g_theEventSystem = new EventSystem(eventSystemConfig);
     g_theEventSystem->SubscribeEventCallbackFunction("WindowCloseEvent", WindowCloseEvent); // Subscribe the WindowCloseEvent
     g_theEventSystem->SubscribeEventCallbackFunction("Event.Console.Startup", Event_ConsoleStartup);
 
+    g_theEventBus = new GameEventBus();
+    g_theEventBus->Subscribe<WindowCloseRequestedEvent, &App::OnWindowCloseRequested>(this);
+
     // Create All Engine Subsystems
     InputSystemConfig inputConfig;
     g_theInput = new InputSystem(inputConfig);
@@ -81,12 +145,27 @@ void App::Startup(char*)
     windowConfig.m_windowTitle = "Protogame3D DirectX12";
     g_theWindow                = new Window(windowConfig);
 
-    RenderConfig renderConfig;
-    renderConfig.m_window        = g_theWindow;
-    renderConfig.m_defaultShader = "Default2D";
-    renderConfig.m_backend       = RendererBackend::DirectX12;
-    g_theRenderer                = IRenderer::CreateRenderer(renderConfig); // Create render
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Render);
+        RenderConfig renderConfig;
+        renderConfig.m_window        = g_theWindow;
+        renderConfig.m_defaultShader = "Default2D";
+        renderConfig.m_backend       = RendererBackend::DirectX12;
+        g_theRenderer                = IRenderer::CreateRenderer(renderConfig); // Create render
+        g_theRenderDevice            = new EngineRenderDevice(g_theRenderer);
+    }
+
+    // 0 (default) runs one thread per hardware thread, the main thread included
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Jobs);
+        g_theJobSystem = new JobSystem(g_gameConfig.GetValue(CONFIG_JOB_THREAD_COUNT, 0));
+    }
 
+    // The game and its entity storage live here, a restart resets it instead of freeing piecemeal
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::GameArena);
+        g_theGameArena = new GameArena();
+    }
 
     DebugRenderConfig debugRenderConfig;
     debugRenderConfig.m_renderer = g_theRenderer;
@@ -115,45 +194,58 @@ void App::Startup(char*)
     GEngine->RegisterSubsystem(std::move(messageLogSubsystem));
 
     // Create and register ImGuiSubsystem (after messagelog)
-    ImGuiSubsystemConfig imguiConfig;
-    imguiConfig.renderer     = g_theRenderer;
-    imguiConfig.targetWindow = g_theWindow;
-    auto imguiSubsystem      = std::make_unique<ImGuiSubsystem>(imguiConfig);
-    GEngine->RegisterSubsystem(std::move(imguiSubsystem));
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::ImGui);
+        ImGuiSubsystemConfig imguiConfig;
+        imguiConfig.renderer     = g_theRenderer;
+        imguiConfig.targetWindow = g_theWindow;
+        auto imguiSubsystem      = std::make_unique<ImGuiSubsystem>(imguiConfig);
+        GEngine->RegisterSubsystem(std::move(imguiSubsystem));
+    }
 
     // Create and register RegisterSubsystem (after imgui, before resource)
-    RegisterConfig registerConfig;
-    registerConfig.enableEvents     = true;
-    registerConfig.threadSafe       = true;
-    registerConfig.enableNamespaces = true;
-    auto registerSubsystem          = std::make_unique<RegisterSubsystem>(registerConfig);
-    GEngine->RegisterSubsystem(std::move(registerSubsystem));
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Registry);
+        RegisterConfig registerConfig;
+        registerConfig.enableEvents     = true;
+        registerConfig.threadSafe       = true;
+        registerConfig.enableNamespaces = true;
+        auto registerSubsystem          = std::make_unique<RegisterSubsystem>(registerConfig);
+        GEngine->RegisterSubsystem(std::move(registerSubsystem));
+    }
 
     // Create ResourceSubsystem with configuration
-    ResourceConfig resourceConfig;
-    resourceConfig.baseAssetPath    = ".enigma/assets";
-    resourceConfig.enableHotReload  = true;
-    resourceConfig.logResourceLoads = true;
-    resourceConfig.printScanResults = true;
-    resourceConfig.AddNamespace("game", ""); // Add custom namespaces - will resolve to .enigma/assets/game
-    resourceConfig.AddNamespace("test", ""); // Add custom namespaces - will resolve to .enigma/assets/test
-    resourceConfig.AddNamespace("featuretest", ""); // Add featuretest namespace for Atlas testing - will resolve to .enigma/assets/featuretest
-    resourceConfig.EnableNamespacePreload("engine", {"sounds/*"}); // Enable preloading for all sounds
-
-    auto resourceSubsystem = std::make_unique<ResourceSubsystem>(resourceConfig);
-
-    // Register ImageLoader before starting up ResourceSubsystem
-    auto imageLoader = std::make_shared<ImageLoader>();
-    resourceSubsystem->RegisterLoader(imageLoader);
-
-    GEngine->RegisterSubsystem(std::move(resourceSubsystem));
+    std::unique_ptr<ResourceSubsystem> resourceSubsystem;
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Resource);
+        ResourceConfig resourceConfig;
+        resourceConfig.baseAssetPath    = ".enigma/assets";
+        resourceConfig.enableHotReload  = true;
+        resourceConfig.logResourceLoads = true;
+        resourceConfig.printScanResults = true;
+        resourceConfig.AddNamespace("game", ""); // Add custom namespaces - will resolve to .enigma/assets/game
+        resourceConfig.AddNamespace("test", ""); // Add custom namespaces - will resolve to .enigma/assets/test
+        resourceConfig.AddNamespace("featuretest", ""); // Add featuretest namespace for Atlas testing - will resolve to .enigma/assets/featuretest
+        resourceConfig.EnableNamespacePreload("engine", {"sounds/*"}); // Enable preloading for all sounds
+
+        resourceSubsystem = std::make_unique<ResourceSubsystem>(resourceConfig);
+
+        // Register ImageLoader before starting up ResourceSubsystem
+        auto imageLoader = std::make_shared<ImageLoader>();
+        resourceSubsystem->RegisterLoader(imageLoader);
+
+        GEngine->RegisterSubsystem(std::move(resourceSubsystem));
+    }
 
     // Create AudioSubsystem with configuration
-    AudioSystemConfig audioConfig;
-    audioConfig.enableResourceIntegration = true;
-    audioConfig.resourceSubsystem         = resourceSubsystem.get();
-    auto audioSubsystem                   = std::make_unique<AudioSubsystem>(audioConfig);
-    GEngine->RegisterSubsystem(std::move(audioSubsystem));
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Audio);
+        AudioSystemConfig audioConfig;
+        audioConfig.enableResourceIntegration = true;
+        audioConfig.resourceSubsystem         = resourceSubsystem.get();
+        auto audioSubsystem                   = std::make_unique<AudioSubsystem>(audioConfig);
+        GEngine->RegisterSubsystem(std::move(audioSubsystem));
+    }
 
     // Set up global pointers for legacy compatibility
     g_theResource = GEngine->GetSubsystem<ResourceSubsystem>();
@@ -164,11 +256,21 @@ void App::Startup(char*)
     // Startup legacy systems first (so renderer device is ready before ImGui initializes)
     g_theInput->Startup();
     g_theWindow->Startup();
-    g_theRenderer->Startup(); // Must startup before GEngine to ensure device is initialized
-    DebugRenderSystemStartup(debugRenderConfig);
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Render);
+        g_theRenderer->Startup(); // Must startup before GEngine to ensure device is initialized
+    }
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::DebugRender);
+        DebugRenderSystemStartup(debugRenderConfig);
+    }
 
-    // Now start Engine subsystems (ImGuiSubsystem::Initialize() will succeed)
-    GEngine->Startup();
+    // Now start Engine subsystems (ImGuiSubsystem::Initialize() will succeed). Every subsystem
+    // starts up inside this one call, so their startup allocations are charged to Engine.
+    {
+        PROFILE_SCOPE("Engine::Startup");
+        GEngine->Startup();
+    }
 
     // Start legacy console last
     g_theDevConsole->Startup();
@@ -184,6 +286,8 @@ void App::Startup(char*)
     {
         // LoggerSubsystem now automatically creates appenders based on configuration
         // No need to manually add appenders - they're created in CreateDefaultAppenders()
+        // The in-game message log (F3) also shows engine output, through whichever sink Game installs
+        loggerSubsystem->AddAppender(std::make_unique<MessageLogEngineAppender>());
 
         // Log levels are also set automatically from configuration, but we can override if needed
         // loggerSubsystem->SetGlobalLogLevel(LogLevel::DEBUG);
@@ -197,8 +301,8 @@ void App::Startup(char*)
 
         // Test formatted logging with same function name
         LogInfo("App", "Screen resolution: %dx%d",
-                static_cast<int>(g_gameConfigBlackboard.GetValue("screenSizeX", 1600.f)),
-                static_cast<int>(g_gameConfigBlackboard.GetValue("screenSizeY", 800.f)));
+                g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_X, 1600),
+                g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_Y, 800));
 
         // Test category-specific convenience functions
         LogEngineInfo("Engine subsystem started successfully");
@@ -245,14 +349,144 @@ void App::Startup(char*)
         LogError("App", "ConsoleSubsystem not found!");
     }
 
-    // Test RegisterSubsystem
-    RunTest_Registrables();
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Tests);
+
+        // Test RegisterSubsystem
+        {
+            PROFILE_SCOPE("RunTest_Registrables");
+            RunTest_Registrables();
+        }
+
+        // Test AtlasSystem
+        {
+            PROFILE_SCOPE("RunTest_AtlasSystem");
+            RunTest_AtlasSystem();
+        }
+
+        // Benchmark typed config lookups against the string blackboard
+        {
+            PROFILE_SCOPE("RunTest_ConfigBlackboard");
+            RunTest_ConfigBlackboard();
+        }
+
+        // Event bus reentrancy and allocation-free fires
+        {
+            PROFILE_SCOPE("RunTest_GameEventBus");
+            RunTest_GameEventBus();
+        }
+
+        // Concurrent producers against the queue behind QueueEvent
+        {
+            PROFILE_SCOPE("RunTest_MpscRingQueue");
+            RunTest_MpscRingQueue();
+        }
 
-    // Test AtlasSystem
-    RunTest_AtlasSystem();
+        // Compare indexed and unindexed mesh generators
+        {
+            PROFILE_SCOPE("RunTest_IndexedMesh");
+            RunTest_IndexedMesh();
+        }
 
-    g_theGame = new Game();
-    g_rng     = new RandomNumberGenerator();
+        // Stress the batched debug shapes
+        {
+            PROFILE_SCOPE("RunTest_DebugShapes");
+            RunTest_DebugShapes();
+        }
+
+        // Debug text layout cache
+        {
+            PROFILE_SCOPE("RunTest_DebugText");
+            RunTest_DebugText();
+        }
+
+        // Frustum culling, batched against scalar
+        {
+            PROFILE_SCOPE("RunTest_FrustumCulling");
+            RunTest_FrustumCulling();
+        }
+
+        // Cached transforms and hierarchy propagation
+        {
+            PROFILE_SCOPE("RunTest_Transform");
+            RunTest_Transform();
+        }
+
+        // SoA entity columns against heap-allocated props, 0 entities (default) skips the benchmark
+        {
+            PROFILE_SCOPE("RunTest_EntityStore");
+            RunTest_EntityStore(g_gameConfig.GetValue(CONFIG_ENTITY_STORE_BENCHMARK_ENTITIES, 0));
+        }
+
+        // Work-stealing jobs, 0 entities (default) skips the thread scaling benchmark
+        {
+            PROFILE_SCOPE("RunTest_JobSystem");
+            RunTest_JobSystem(g_gameConfig.GetValue(CONFIG_JOB_BENCHMARK_ENTITIES, 0));
+        }
+
+        // Broadphases against brute force, 0 entities (default) skips the pairs/s benchmark
+        {
+            PROFILE_SCOPE("RunTest_Collision");
+            RunTest_Collision(g_gameConfig.GetValue(CONFIG_COLLISION_BENCHMARK_ENTITIES, 0));
+        }
+
+        // Arena reset against heap teardown for a synthetic game-sized object population, 0 restarts (default) skips the benchmark
+        {
+            PROFILE_SCOPE("RunTest_GameArena");
+            RunTest_GameArena(g_gameConfig.GetValue(CONFIG_GAME_ARENA_BENCHMARK_RESTARTS, 0));
+        }
+
+        // Snapshot ring ordering, then sequential against pipelined frame times, 0 entities (default) skips the benchmark
+        {
+            PROFILE_SCOPE("RunTest_RenderPipeline");
+            RunTest_RenderPipeline(g_gameConfig.GetValue(CONFIG_RENDER_PIPELINE_BENCHMARK_ENTITIES, 0));
+        }
+
+        // Sorted submission against per-draw state
+        {
+            PROFILE_SCOPE("RunTest_RenderCommandQueue");
+            RunTest_RenderCommandQueue();
+        }
+
+        // Scope nesting across threads, trace export and per-scope overhead
+        {
+            PROFILE_SCOPE("RunTest_Profiler");
+            RunTest_Profiler();
+        }
+
+        // Tag attribution, frame counts and the cost of a tracked allocation
+        {
+            PROFILE_SCOPE("RunTest_MemoryTracker");
+            RunTest_MemoryTracker();
+        }
+
+        // Drive the game against the null render backend, 0 frames (default) skips it
+        {
+            PROFILE_SCOPE("RunTest_HeadlessRender");
+            RunTest_HeadlessRender(g_gameConfig.GetValue(CONFIG_HEADLESS_BENCHMARK_FRAMES, 0));
+        }
+    }
+
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Game);
+        {
+            PROFILE_SCOPE("Game::Game");
+            g_theGame = g_theGameArena->New<Game>();
+        }
+        g_rng = new RandomNumberGenerator();
+    }
+
+    // 0 (default) renders each frame after its own update. Otherwise a render thread prepares the
+    // world one frame (2 snapshots) or two frames (3 snapshots) behind the simulation
+    int renderSnapshotCount = g_gameConfig.GetValue(CONFIG_RENDER_SNAPSHOT_COUNT, 0);
+    if (renderSnapshotCount > 0)
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Render);
+        m_renderPipeline = new RenderPipeline([](RenderSnapshot& snapshot)
+        {
+            g_theGame->PrepareRenderSnapshot(snapshot);
+        }, renderSnapshotCount);
+    }
 }
 
 void App::Shutdown()
@@ -261,10 +495,24 @@ void App::Shutdown()
      *  All Destroy and ShutDown process should be reverse order of the StartUp
      */
 
+    // The render thread reads the game, stop it first
+    delete m_renderPipeline;
+    m_renderPipeline = nullptr;
+
     // Destroy the game
-    delete g_theGame;
+    g_theGameArena->Delete(g_theGame);
     g_theGame = nullptr;
 
+    delete g_theGameArena;
+    g_theGameArena = nullptr;
+
+    delete g_theJobSystem;
+    g_theJobSystem = nullptr;
+
+    // Every thread that records scopes has stopped
+    delete g_theProfiler;
+    g_theProfiler = nullptr;
+
     // Shutdown Engine subsystems (handles ResourceSubsystem and AudioSubsystem)
     GEngine->Shutdown();
 
@@ -283,6 +531,9 @@ void App::Shutdown()
     delete g_theDevConsole;
     g_theDevConsole = nullptr;
 
+    delete g_theRenderDevice;
+    g_theRenderDevice = nullptr;
+
     delete g_theRenderer;
     g_theRenderer = nullptr;
 
@@ -295,15 +546,29 @@ void App::Shutdown()
     delete g_theEventSystem;
     g_theEventSystem = nullptr;
 
+    delete g_theEventBus;
+    g_theEventBus = nullptr;
+
     // Destroy Engine instance
     enigma::core::Engine::DestroyInstance();
 }
 
 void App::RunFrame()
 {
+    // Closes the previous frame's profile; the first time, startup's
+    g_theProfiler->EndFrame();
+    if (m_exportStartupTrace)
+    {
+        g_theProfiler->ExportChromeTrace(".enigma/profile/startup.json");
+        m_exportStartupTrace = false;
+    }
+    MemoryTracker::EndFrame();
+
     BeginFrame(); //Engine pre-frame stuff
     Update(); // Game updates / moves / spawns / hurts
-    Render(); // Game draws current state of things
+    UpdateSimulation(); // Fixed-rate steps, however long the frame took
+    CaptureRenderSnapshot(); // Pipelined only, the render thread prepares it while the next frame simulates
+    Render(); // Game draws current state of things, or a prepared snapshot when pipelined
     EndFrame(); // Engine post-frame
 }
 
@@ -417,6 +682,8 @@ void App::AdjustForPauseAndTimeDistortion()
 
 void App::BeginFrame()
 {
+    PROFILE_SCOPE("App::BeginFrame");
+    MEMORY_TAG_SCOPE(MemoryTag::Engine);
     Clock::TickSystemClock();
 
     // Begin Engine subsystems frame (includes ImGuiSubsystem::BeginFrame())
@@ -424,10 +691,21 @@ void App::BeginFrame()
 
     g_theInput->BeginFrame();
     g_theWindow->BeginFrame();
-    g_theRenderer->BeginFrame();
-    DebugRenderBeginFrame();
-    g_theAudio->BeginFrame();
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Render);
+        g_theRenderer->BeginFrame();
+        g_theRenderDevice->BeginFrame();
+    }
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::DebugRender);
+        DebugRenderBeginFrame();
+    }
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Audio);
+        g_theAudio->BeginFrame();
+    }
     g_theEventSystem->BeginFrame();
+    g_theEventBus->DispatchQueuedEvents(); // Deliver events queued by worker threads since last frame
     g_theDevConsole->BeginFrame();
 }
 
@@ -437,17 +715,22 @@ void App::UpdateCameras()
 
 void App::Update()
 {
-    // Calculate delta time
-    static float lastTime    = 0.0f;
-    float        currentTime = Clock::GetSystemClock().GetTotalSeconds();
-    float        deltaTime   = currentTime - lastTime;
-    lastTime                 = currentTime;
+    PROFILE_SCOPE("App::Update");
+    MEMORY_TAG_SCOPE(MemoryTag::Engine);
+    float deltaTime = Clock::GetSystemClock().GetDeltaSeconds();
 
     // Update Engine subsystems (including ConsoleSubsystem)
-    GEngine->Update(deltaTime);
+    {
+        PROFILE_SCOPE("Engine::Update");
+        GEngine->Update(deltaTime);
+    }
 
     // Update resource system for hot reload
-    g_theResource->Update();
+    {
+        PROFILE_SCOPE("ResourceSubsystem::Update");
+        MEMORY_TAG_SCOPE(MemoryTag::Resource);
+        g_theResource->Update();
+    }
 
     /// Cursor
     auto windowHandle   = static_cast<HWND>(g_theWindow->GetWindowHandle());
@@ -467,28 +750,96 @@ void App::Update()
 
     HandleKeyBoardEvent();
     AdjustForPauseAndTimeDistortion();
-    g_theGame->Update();
+    {
+        PROFILE_SCOPE("Game::Update");
+        MEMORY_TAG_SCOPE(MemoryTag::Game);
+        g_theGame->Update();
+    }
+}
+
+void App::UpdateSimulation()
+{
+    PROFILE_SCOPE("App::UpdateSimulation");
+    MEMORY_TAG_SCOPE(MemoryTag::Game);
+    // Game clock time, so pause and slow motion change how many steps run, never their length
+    m_simulationAccumulator += static_cast<double>(g_theGame->m_clock->GetDeltaSeconds());
+
+    int stepCount = 0;
+    while (m_simulationAccumulator >= m_fixedDeltaSeconds && stepCount < m_maxSimulationSteps)
+    {
+        g_theGame->FixedUpdate(m_fixedDeltaSeconds);
+        m_simulationAccumulator -= m_fixedDeltaSeconds;
+        ++stepCount;
+    }
+    if (m_simulationAccumulator >= m_fixedDeltaSeconds)
+    {
+        // Too far behind to catch up; more steps would only make the next frame longer still
+        m_simulationAccumulator = std::fmod(m_simulationAccumulator, static_cast<double>(m_fixedDeltaSeconds));
+    }
+
+    g_theGame->UpdateInterpolation(static_cast<float>(m_simulationAccumulator / m_fixedDeltaSeconds));
+}
+
+void App::CaptureRenderSnapshot()
+{
+    if (!m_renderPipeline)
+    {
+        return;
+    }
+    PROFILE_SCOPE("App::CaptureRenderSnapshot");
+    MEMORY_TAG_SCOPE(MemoryTag::Render);
+    RenderSnapshot& snapshot = m_renderPipeline->BeginCapture();
+    g_theGame->CaptureRenderSnapshot(snapshot);
+    m_renderPipeline->EndCapture();
 }
 
 // If this methods is const, the methods inn the method should also promise
 // const
 void App::Render() const
 {
-    g_theRenderer->ClearScreen(Rgba8(m_backgroundColor));
-    g_theGame->Render();
+    PROFILE_SCOPE("App::Render");
+    MEMORY_TAG_SCOPE(MemoryTag::Render);
+    g_theRenderDevice->ClearScreen(Rgba8(m_backgroundColor));
+    if (m_renderPipeline)
+    {
+        // Null for the first frames, until the ring has filled
+        RenderSnapshot* worldSnapshot = m_renderPipeline->AcquirePrepared();
+        g_theGame->Render(worldSnapshot);
+        if (worldSnapshot)
+        {
+            m_renderPipeline->ReleasePrepared();
+        }
+    }
+    else
+    {
+        g_theGame->Render();
+    }
     g_theDevConsole->Render(m_consoleSpace);
 
     // Render ImGui (after all other rendering)
+    PROFILE_SCOPE("ImGui::Render");
+    MEMORY_TAG_SCOPE(MemoryTag::ImGui);
     g_theImGui->Render();
 }
 
 void App::EndFrame()
 {
+    PROFILE_SCOPE("App::EndFrame");
+    MEMORY_TAG_SCOPE(MemoryTag::Engine);
     g_theWindow->EndFrame();
-    g_theRenderer->EndFrame();
-    DebugRenderEndFrame();
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Render);
+        g_theRenderer->EndFrame();
+    }
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::DebugRender);
+        DebugRenderEndFrame();
+    }
     g_theInput->EndFrame();
-    g_theAudio->EndFrame();
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Audio);
+        g_theAudio->EndFrame();
+    }
     g_theEventSystem->EndFrame();
     g_theDevConsole->EndFrame();
 
@@ -497,10 +848,18 @@ void App::EndFrame()
 
     if (m_isPendingRestart)
     {
-        delete g_theGame;
-        g_theGame = nullptr;
-        g_theGame = new Game();
+        MEMORY_TAG_SCOPE(MemoryTag::Game);
+        // Snapshots still in flight point at the old game's meshes
+        if (m_renderPipeline)
+        {
+            m_renderPipeline->Discard();
+        }
+        // Destructors release GPU meshes and other outside resources; the game's memory goes in one reset
+        g_theGameArena->Delete(g_theGame);
+        g_theGameArena->Reset();
+        g_theGame = g_theGameArena->New<Game>();
         // Restore state
+        m_simulationAccumulator = 0.0;
         m_isPendingRestart = false;
         m_isPaused         = false;
     }
@@ -516,6 +875,7 @@ void App::LoadGameConfig(const char* filename)
         if (rootElement)
         {
             g_gameConfigBlackboard.PopulateFromXmlElementAttributes(*rootElement);
+            g_gameConfig.PopulateFromXmlElementAttributes(*rootElement);
             DebuggerPrintf("[SYSTEM]    Game config from file \"%s\" was loaded\n", filename);
         }
         else
@@ -529,6 +889,13 @@ void App::LoadGameConfig(const char* filename)
     }
 }
 
+bool App::OnWindowCloseRequested(const WindowCloseRequestedEvent& event)
+{
+    UNUSED(event)
+    HandleQuitRequested();
+    return false;
+}
+
 bool App::WindowCloseEvent(EventArgs& args)
 {
     UNUSED(args)
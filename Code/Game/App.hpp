@@ -4,6 +4,8 @@
 
 class Window;
 class Game;
+class RenderPipeline;
+struct WindowCloseRequestedEvent;
 
 // Forward declaration for resource system
 namespace enigma::resource
@@ -31,11 +33,17 @@ public:
 
     /// Event Handle
     static bool Event_ConsoleStartup(EventArgs& args);
+    bool        OnWindowCloseRequested(const WindowCloseRequestedEvent& event);
     
 private:
     void BeginFrame();
     void UpdateCameras();
     void Update();
+    /// Runs as many fixed simulation steps as the game clock has accumulated, at most
+    /// m_maxSimulationSteps, then interpolates render state by the leftover fraction of a step
+    void UpdateSimulation();
+    /// Pipelined render only: hands this frame's world to the render thread
+    void CaptureRenderSnapshot();
 
     void Render() const;
     void EndFrame();
@@ -55,5 +63,16 @@ public:
 
     AABB2 m_consoleSpace;
 
+    /// Fixed-step simulation
+    float  m_fixedDeltaSeconds     = 1.f / 60.f;
+    int    m_maxSimulationSteps    = 5; // Per frame, beyond it the backlog is dropped and the game slows down
+    double m_simulationAccumulator = 0.0;
+
+    /// Render thread and snapshot ring, null when renderSnapshotCount is 0 and frames run in sequence
+    RenderPipeline* m_renderPipeline = nullptr;
+
+    /// Writes the startup profile as a Chrome trace once the first frame closes it
+    bool m_exportStartupTrace = false;
+
     STATIC bool WindowCloseEvent(EventArgs& args);
 };
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/Vec3.hpp"
+
+/// World-space axis-aligned box a broadphase proxy occupies
+struct CollisionBounds
+{
+    Vec3 m_mins;
+    Vec3 m_maxs;
+
+    bool Overlaps(const CollisionBounds& other) const
+    {
+        // Non-short-circuit: about half the tested pairs overlap, so early-outs mispredict
+        return (m_mins.x <= other.m_maxs.x) & (other.m_mins.x <= m_maxs.x) &
+            (m_mins.y <= other.m_maxs.y) & (other.m_mins.y <= m_maxs.y) &
+            (m_mins.z <= other.m_maxs.z) & (other.m_mins.z <= m_maxs.z);
+    }
+};
+
+/// Two proxies whose bounds overlap, as the user data they were added with
+struct CollisionPair
+{
+    uint32_t m_userDataA = 0;
+    uint32_t m_userDataB = 0;
+};
+
+//-----------------------------------------------------------------------------------------------
+// Finds the pairs of proxies whose bounds overlap, without testing every pair. Proxies are added
+// once and moved only when their bounds change, so a broadphase can keep its structure between
+// frames and pay only for what moved. Every overlapping pair is reported exactly once per
+// FindPairs(), in no particular order.
+//
+class Broadphase
+{
+public:
+    static constexpr uint32_t INVALID_PROXY = 0xFFFFFFFFu;
+
+    virtual ~Broadphase() = default;
+
+    virtual uint32_t AddProxy(const CollisionBounds& bounds, uint32_t userData) = 0;
+    /// proxyId must be live; moving a removed proxy dies
+    virtual void     MoveProxy(uint32_t proxyId, const CollisionBounds& bounds) = 0;
+    virtual void     RemoveProxy(uint32_t proxyId) = 0;
+
+    /// Replaces outPairs with every overlapping pair
+    virtual void   FindPairs(std::vector<CollisionPair>& outPairs) = 0;
+    virtual size_t GetProxyCount() const = 0;
+};
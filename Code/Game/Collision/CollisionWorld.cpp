@@ -0,0 +1,149 @@
+#include "CollisionWorld.hpp"
+
+#include <utility>
+
+CollisionWorld::CollisionWorld(std::unique_ptr<Broadphase> broadphase, std::pmr::memory_resource* memory)
+    : m_ownedBroadphase(std::move(broadphase))
+    , m_broadphase(m_ownedBroadphase.get())
+    , m_colliders(memory)
+    , m_freeColliders(memory)
+    , m_colliderByEntity(memory)
+{
+}
+
+CollisionWorld::CollisionWorld(Broadphase& broadphase, std::pmr::memory_resource* memory)
+    : m_broadphase(&broadphase)
+    , m_colliders(memory)
+    , m_freeColliders(memory)
+    , m_colliderByEntity(memory)
+{
+}
+
+void CollisionWorld::AddSphere(const EntityStore& entities, EntityHandle entity, float radius)
+{
+    AddCollider(entities, entity, Vec3(), radius);
+}
+
+void CollisionWorld::AddBox(const EntityStore& entities, EntityHandle entity, const Vec3& halfExtents)
+{
+    AddCollider(entities, entity, halfExtents, 0.f);
+}
+
+void CollisionWorld::Remove(EntityHandle entity)
+{
+    if (entity.m_index < m_colliderByEntity.size() && m_colliderByEntity[entity.m_index] != Broadphase::INVALID_PROXY)
+    {
+        uint32_t colliderIndex = m_colliderByEntity[entity.m_index];
+        if (m_colliders[colliderIndex].m_entity == entity)
+        {
+            RemoveCollider(colliderIndex);
+        }
+    }
+}
+
+void CollisionWorld::Update(const EntityStore& entities)
+{
+    const Vec3Column& positions = entities.GetPositions();
+    for (uint32_t colliderIndex = 0; colliderIndex < m_colliders.size(); ++colliderIndex)
+    {
+        Collider& collider = m_colliders[colliderIndex];
+        if (collider.m_proxyId == Broadphase::INVALID_PROXY)
+        {
+            continue;
+        }
+        uint32_t denseIndex = entities.GetDenseIndex(collider.m_entity);
+        if (denseIndex == EntityHandle::INVALID_INDEX)
+        {
+            RemoveCollider(colliderIndex);
+            continue;
+        }
+
+        // Only movers touch the broadphase
+        float x = positions.m_x[denseIndex];
+        float y = positions.m_y[denseIndex];
+        float z = positions.m_z[denseIndex];
+        if (x != collider.m_center.x || y != collider.m_center.y || z != collider.m_center.z)
+        {
+            collider.m_center = Vec3(x, y, z);
+            m_broadphase->MoveProxy(collider.m_proxyId, GetBounds(collider));
+        }
+    }
+}
+
+void CollisionWorld::FindContacts(std::vector<EntityContact>& outContacts)
+{
+    outContacts.clear();
+    m_broadphase->FindPairs(m_candidatePairs);
+
+    m_narrowphase.Clear();
+    m_narrowphase.Reserve(m_candidatePairs.size());
+    for (const CollisionPair& pair : m_candidatePairs)
+    {
+        const Collider& colliderA = m_colliders[pair.m_userDataA];
+        const Collider& colliderB = m_colliders[pair.m_userDataB];
+        m_narrowphase.Add(colliderA.m_center, colliderA.m_halfExtents, colliderA.m_radius, colliderB.m_center, colliderB.m_halfExtents, colliderB.m_radius);
+    }
+    m_narrowphase.Run(m_overlappingIndexes);
+
+    outContacts.reserve(m_overlappingIndexes.size());
+    for (uint32_t pairIndex : m_overlappingIndexes)
+    {
+        const CollisionPair& pair = m_candidatePairs[pairIndex];
+        outContacts.push_back({m_colliders[pair.m_userDataA].m_entity, m_colliders[pair.m_userDataB].m_entity});
+    }
+}
+
+void CollisionWorld::AddCollider(const EntityStore& entities, EntityHandle entity, const Vec3& halfExtents, float radius)
+{
+    if (!entities.IsAlive(entity))
+    {
+        return;
+    }
+    Remove(entity); // One collider per entity, the new one replaces it
+
+    uint32_t colliderIndex;
+    if (!m_freeColliders.empty())
+    {
+        colliderIndex = m_freeColliders.back();
+        m_freeColliders.pop_back();
+    }
+    else
+    {
+        colliderIndex = static_cast<uint32_t>(m_colliders.size());
+        m_colliders.emplace_back();
+    }
+
+    Collider& collider     = m_colliders[colliderIndex];
+    collider.m_entity      = entity;
+    collider.m_center      = entities.GetPosition(entity);
+    collider.m_halfExtents = halfExtents;
+    collider.m_radius      = radius;
+    collider.m_proxyId     = m_broadphase->AddProxy(GetBounds(collider), colliderIndex);
+
+    if (entity.m_index >= m_colliderByEntity.size())
+    {
+        m_colliderByEntity.resize(entity.m_index + 1, Broadphase::INVALID_PROXY);
+    }
+    m_colliderByEntity[entity.m_index] = colliderIndex;
+}
+
+void CollisionWorld::RemoveCollider(uint32_t colliderIndex)
+{
+    Collider& collider = m_colliders[colliderIndex];
+    m_broadphase->RemoveProxy(collider.m_proxyId);
+    collider.m_proxyId = Broadphase::INVALID_PROXY;
+    m_freeColliders.push_back(colliderIndex);
+
+    // A dead entity's slot may already belong to a new entity with its own collider
+    uint32_t& entityCollider = m_colliderByEntity[collider.m_entity.m_index];
+    if (entityCollider == colliderIndex)
+    {
+        entityCollider = Broadphase::INVALID_PROXY;
+    }
+}
+
+CollisionBounds CollisionWorld::GetBounds(const Collider& collider) const
+{
+    Vec3 reach = collider.m_halfExtents + Vec3(collider.m_radius, collider.m_radius, collider.m_radius);
+    return {collider.m_center - reach, collider.m_center + reach};
+}
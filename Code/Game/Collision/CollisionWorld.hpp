@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Collision/Broadphase.hpp"
+#include "Game/Collision/Narrowphase.hpp"
+#include "Game/EntityStore.hpp"
+
+/// Two entities whose colliders overlap this frame
+struct EntityContact
+{
+    EntityHandle m_entityA;
+    EntityHandle m_entityB;
+};
+
+//-----------------------------------------------------------------------------------------------
+// Colliders for EntityStore entities: spheres and axis-aligned boxes centered on the entity
+// position (orientation is ignored). Update() compares each collider against its entity's
+// position and moves only the broadphase proxies of entities that moved; colliders whose entity
+// is gone are dropped there too. FindContacts() runs the broadphase for candidate pairs and the
+// batched narrowphase for exact overlaps. The collider tables draw from the given memory resource;
+// the per-frame pair buffers are reused from frame to frame and stay on the heap.
+//
+class CollisionWorld
+{
+public:
+    explicit CollisionWorld(std::unique_ptr<Broadphase> broadphase, std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    /// Uses a broadphase the caller owns and outlives this world, so both can sit in one arena
+    explicit CollisionWorld(Broadphase& broadphase, std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    CollisionWorld(const CollisionWorld&)            = delete;
+    CollisionWorld& operator=(const CollisionWorld&) = delete;
+
+    void AddSphere(const EntityStore& entities, EntityHandle entity, float radius);
+    void AddBox(const EntityStore& entities, EntityHandle entity, const Vec3& halfExtents);
+    void Remove(EntityHandle entity);
+
+    void Update(const EntityStore& entities);
+    void FindContacts(std::vector<EntityContact>& outContacts);
+
+    size_t      GetColliderCount() const { return m_broadphase->GetProxyCount(); }
+    Broadphase& GetBroadphase() const { return *m_broadphase; }
+    /// Broadphase pairs from the last FindContacts(), before the narrowphase
+    size_t GetCandidatePairCount() const { return m_candidatePairs.size(); }
+
+private:
+    struct Collider
+    {
+        EntityHandle m_entity;
+        Vec3         m_center;
+        Vec3         m_halfExtents; // Zero for a sphere
+        float        m_radius  = 0.f; // Zero for a box
+        uint32_t     m_proxyId = Broadphase::INVALID_PROXY;
+    };
+
+    void            AddCollider(const EntityStore& entities, EntityHandle entity, const Vec3& halfExtents, float radius);
+    void            RemoveCollider(uint32_t colliderIndex);
+    CollisionBounds GetBounds(const Collider& collider) const;
+
+    std::unique_ptr<Broadphase> m_ownedBroadphase;   // Empty when the caller owns it
+    Broadphase*                 m_broadphase = nullptr;
+    std::pmr::vector<Collider>  m_colliders;         // Stable indexes, proxies carry them as user data
+    std::pmr::vector<uint32_t>  m_freeColliders;
+    std::pmr::vector<uint32_t>  m_colliderByEntity;  // Indexed by EntityHandle::m_index
+
+    std::vector<CollisionPair> m_candidatePairs;
+    Narrowphase                m_narrowphase;
+    std::vector<uint32_t>      m_overlappingIndexes;
+};
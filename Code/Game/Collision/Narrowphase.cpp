@@ -0,0 +1,111 @@
+#include "Narrowphase.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Math/Vec3.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#define NARROWPHASE_SSE 1
+#include <xmmintrin.h>
+#else
+#define NARROWPHASE_SSE 0
+#endif
+
+void Narrowphase::Clear()
+{
+    m_offsetX.clear();
+    m_offsetY.clear();
+    m_offsetZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+    m_radius.clear();
+}
+
+void Narrowphase::Reserve(size_t count)
+{
+    m_offsetX.reserve(count);
+    m_offsetY.reserve(count);
+    m_offsetZ.reserve(count);
+    m_extentX.reserve(count);
+    m_extentY.reserve(count);
+    m_extentZ.reserve(count);
+    m_radius.reserve(count);
+}
+
+uint32_t Narrowphase::Add(const Vec3& centerA, const Vec3& halfExtentsA, float radiusA, const Vec3& centerB, const Vec3& halfExtentsB, float radiusB)
+{
+    uint32_t index = static_cast<uint32_t>(m_radius.size());
+    m_offsetX.push_back(centerB.x - centerA.x);
+    m_offsetY.push_back(centerB.y - centerA.y);
+    m_offsetZ.push_back(centerB.z - centerA.z);
+    m_extentX.push_back(halfExtentsA.x + halfExtentsB.x);
+    m_extentY.push_back(halfExtentsA.y + halfExtentsB.y);
+    m_extentZ.push_back(halfExtentsA.z + halfExtentsB.z);
+    m_radius.push_back(radiusA + radiusB);
+    return index;
+}
+
+void Narrowphase::Run(std::vector<uint32_t>& outOverlappingIndexes) const
+{
+#if NARROWPHASE_SSE
+    outOverlappingIndexes.clear();
+    size_t count       = m_radius.size();
+    size_t vectorCount = count & ~static_cast<size_t>(3);
+
+    const __m128 zero    = _mm_setzero_ps();
+    const __m128 signBit = _mm_set1_ps(-0.f);
+    for (size_t i = 0; i < vectorCount; i += 4)
+    {
+        // Same operation order as OverlapsScalar(), so both paths agree bit for bit
+        __m128 distanceX = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signBit, _mm_loadu_ps(&m_offsetX[i])), _mm_loadu_ps(&m_extentX[i])), zero);
+        __m128 distanceY = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signBit, _mm_loadu_ps(&m_offsetY[i])), _mm_loadu_ps(&m_extentY[i])), zero);
+        __m128 distanceZ = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signBit, _mm_loadu_ps(&m_offsetZ[i])), _mm_loadu_ps(&m_extentZ[i])), zero);
+        __m128 radius    = _mm_loadu_ps(&m_radius[i]);
+
+        __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(distanceX, distanceX), _mm_mul_ps(distanceY, distanceY)), _mm_mul_ps(distanceZ, distanceZ));
+        int    overlapMask     = _mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_mul_ps(radius, radius)));
+        while (overlapMask)
+        {
+            int lane = 0;
+            while (!(overlapMask & (1 << lane)))
+            {
+                ++lane;
+            }
+            outOverlappingIndexes.push_back(static_cast<uint32_t>(i + lane));
+            overlapMask &= overlapMask - 1;
+        }
+    }
+
+    for (size_t i = vectorCount; i < count; ++i)
+    {
+        if (OverlapsScalar(i))
+        {
+            outOverlappingIndexes.push_back(static_cast<uint32_t>(i));
+        }
+    }
+#else
+    RunScalar(outOverlappingIndexes);
+#endif
+}
+
+void Narrowphase::RunScalar(std::vector<uint32_t>& outOverlappingIndexes) const
+{
+    outOverlappingIndexes.clear();
+    for (size_t i = 0; i < m_radius.size(); ++i)
+    {
+        if (OverlapsScalar(i))
+        {
+            outOverlappingIndexes.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+bool Narrowphase::OverlapsScalar(size_t index) const
+{
+    float distanceX = std::max(std::fabs(m_offsetX[index]) - m_extentX[index], 0.f);
+    float distanceY = std::max(std::fabs(m_offsetY[index]) - m_extentY[index], 0.f);
+    float distanceZ = std::max(std::fabs(m_offsetZ[index]) - m_extentZ[index], 0.f);
+    return distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ <= m_radius[index] * m_radius[index];
+}
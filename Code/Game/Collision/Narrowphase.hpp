@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct Vec3;
+
+//-----------------------------------------------------------------------------------------------
+// Batched exact overlap tests for broadphase candidate pairs. Every shape is a rounded box: a
+// sphere is a box with zero half extents, an axis-aligned box is a rounded box with zero radius.
+// Two shapes overlap exactly when their center offset lies within the Minkowski sum, which is
+// again a rounded box:
+//
+//     d = max(|offset| - (halfExtentsA + halfExtentsB), 0) per axis,  overlap iff |d|^2 <= (radiusA + radiusB)^2
+//
+// That covers sphere/sphere, sphere/box and box/box with one formula, so a batch of mixed pairs
+// runs four at a time through the same SSE path without sorting pairs by shape.
+//
+// Typical use per frame: Clear(), Add() every candidate pair in a known order, then Run() and map
+// the returned indexes back to the pairs.
+//
+class Narrowphase
+{
+public:
+    void     Clear();
+    void     Reserve(size_t count);
+    uint32_t Add(const Vec3& centerA, const Vec3& halfExtentsA, float radiusA, const Vec3& centerB, const Vec3& halfExtentsB, float radiusB);
+
+    /// Replaces outOverlappingIndexes with the ascending indexes of the pairs that overlap
+    void Run(std::vector<uint32_t>& outOverlappingIndexes) const;
+    /// One pair at a time through the same test, the reference Run() must agree with
+    void RunScalar(std::vector<uint32_t>& outOverlappingIndexes) const;
+
+    size_t GetCount() const { return m_radius.size(); }
+
+private:
+    bool OverlapsScalar(size_t index) const;
+
+    std::vector<float> m_offsetX; // Center of B minus center of A
+    std::vector<float> m_offsetY;
+    std::vector<float> m_offsetZ;
+    std::vector<float> m_extentX; // Summed half extents
+    std::vector<float> m_extentY;
+    std::vector<float> m_extentZ;
+    std::vector<float> m_radius;  // Summed radii
+};
@@ -0,0 +1,176 @@
+#include "SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+SpatialHashGrid::SpatialHashGrid(const Vec2& worldMins, const Vec2& worldMaxs, float cellSize, std::pmr::memory_resource* memory)
+    : m_worldMins(worldMins)
+    , m_cells(memory)
+    , m_proxies(memory)
+    , m_freeProxies(memory)
+{
+    cellSize          = std::max(cellSize, 0.001f);
+    m_inverseCellSize = 1.f / cellSize;
+    m_cellCountX      = std::max(1, static_cast<int>(std::ceil((worldMaxs.x - worldMins.x) * m_inverseCellSize)));
+    m_cellCountY      = std::max(1, static_cast<int>(std::ceil((worldMaxs.y - worldMins.y) * m_inverseCellSize)));
+    m_cells.resize(static_cast<size_t>(m_cellCountX) * m_cellCountY);
+}
+
+uint32_t SpatialHashGrid::AddProxy(const CollisionBounds& bounds, uint32_t userData)
+{
+    uint32_t proxyId;
+    if (!m_freeProxies.empty())
+    {
+        proxyId = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+    else
+    {
+        proxyId = static_cast<uint32_t>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy     = m_proxies[proxyId];
+    proxy.m_cells    = GetCellRange(bounds);
+    proxy.m_userData = userData;
+    proxy.m_isAlive  = true;
+    InsertIntoCells(proxyId, bounds, proxy.m_cells);
+    return proxyId;
+}
+
+void SpatialHashGrid::MoveProxy(uint32_t proxyId, const CollisionBounds& bounds)
+{
+    Proxy& proxy = m_proxies[proxyId];
+    ASSERT_OR_DIE(proxy.m_isAlive, "SpatialHashGrid: MoveProxy on a removed proxy");
+    CellRange cells = GetCellRange(bounds);
+    if (cells == proxy.m_cells)
+    {
+        UpdateInCells(proxyId, bounds, cells);
+        return;
+    }
+    RemoveFromCells(proxyId, proxy.m_cells);
+    InsertIntoCells(proxyId, bounds, cells);
+    proxy.m_cells = cells;
+    ++m_rebinCount;
+}
+
+void SpatialHashGrid::RemoveProxy(uint32_t proxyId)
+{
+    Proxy& proxy = m_proxies[proxyId];
+    if (!proxy.m_isAlive)
+    {
+        return;
+    }
+    RemoveFromCells(proxyId, proxy.m_cells);
+    proxy.m_isAlive = false;
+    m_freeProxies.push_back(proxyId);
+}
+
+void SpatialHashGrid::FindPairs(std::vector<CollisionPair>& outPairs)
+{
+    outPairs.clear();
+    for (int cellY = 0; cellY < m_cellCountY; ++cellY)
+    {
+        for (int cellX = 0; cellX < m_cellCountX; ++cellX)
+        {
+            const std::pmr::vector<CellEntry>& cell = m_cells[static_cast<size_t>(cellY) * m_cellCountX + cellX];
+            for (size_t i = 0; i + 1 < cell.size(); ++i)
+            {
+                const CellEntry& entryA = cell[i];
+                for (size_t j = i + 1; j < cell.size(); ++j)
+                {
+                    const CellEntry& entryB = cell[j];
+                    if (!entryA.m_bounds.Overlaps(entryB.m_bounds))
+                    {
+                        continue;
+                    }
+                    // Both proxies share every cell the overlap touches; report from its minimum corner only
+                    if (GetCellX(std::max(entryA.m_bounds.m_mins.x, entryB.m_bounds.m_mins.x)) != cellX ||
+                        GetCellY(std::max(entryA.m_bounds.m_mins.y, entryB.m_bounds.m_mins.y)) != cellY)
+                    {
+                        continue;
+                    }
+                    outPairs.push_back({entryA.m_userData, entryB.m_userData});
+                }
+            }
+        }
+    }
+}
+
+int SpatialHashGrid::GetCellX(float x) const
+{
+    int cellX = static_cast<int>(std::floor((x - m_worldMins.x) * m_inverseCellSize));
+    return std::clamp(cellX, 0, m_cellCountX - 1);
+}
+
+int SpatialHashGrid::GetCellY(float y) const
+{
+    int cellY = static_cast<int>(std::floor((y - m_worldMins.y) * m_inverseCellSize));
+    return std::clamp(cellY, 0, m_cellCountY - 1);
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::GetCellRange(const CollisionBounds& bounds) const
+{
+    CellRange cells;
+    cells.m_minX = GetCellX(bounds.m_mins.x);
+    cells.m_minY = GetCellY(bounds.m_mins.y);
+    cells.m_maxX = GetCellX(bounds.m_maxs.x);
+    cells.m_maxY = GetCellY(bounds.m_maxs.y);
+    return cells;
+}
+
+void SpatialHashGrid::InsertIntoCells(uint32_t proxyId, const CollisionBounds& bounds, const CellRange& cells)
+{
+    CellEntry entry;
+    entry.m_bounds   = bounds;
+    entry.m_proxyId  = proxyId;
+    entry.m_userData = m_proxies[proxyId].m_userData;
+    for (int cellY = cells.m_minY; cellY <= cells.m_maxY; ++cellY)
+    {
+        for (int cellX = cells.m_minX; cellX <= cells.m_maxX; ++cellX)
+        {
+            m_cells[static_cast<size_t>(cellY) * m_cellCountX + cellX].push_back(entry);
+        }
+    }
+}
+
+void SpatialHashGrid::UpdateInCells(uint32_t proxyId, const CollisionBounds& bounds, const CellRange& cells)
+{
+    for (int cellY = cells.m_minY; cellY <= cells.m_maxY; ++cellY)
+    {
+        for (int cellX = cells.m_minX; cellX <= cells.m_maxX; ++cellX)
+        {
+            for (CellEntry& entry : m_cells[static_cast<size_t>(cellY) * m_cellCountX + cellX])
+            {
+                if (entry.m_proxyId == proxyId)
+                {
+                    entry.m_bounds = bounds;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::RemoveFromCells(uint32_t proxyId, const CellRange& cells)
+{
+    for (int cellY = cells.m_minY; cellY <= cells.m_maxY; ++cellY)
+    {
+        for (int cellX = cells.m_minX; cellX <= cells.m_maxX; ++cellX)
+        {
+            // Cells hold a handful of proxies, a linear find and swap-remove beats any index
+            std::pmr::vector<CellEntry>& cell = m_cells[static_cast<size_t>(cellY) * m_cellCountX + cellX];
+            for (CellEntry& entry : cell)
+            {
+                if (entry.m_proxyId == proxyId)
+                {
+                    entry = cell.back();
+                    cell.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+}
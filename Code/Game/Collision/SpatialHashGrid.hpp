@@ -0,0 +1,84 @@
+#pragma once
+#include <memory_resource>
+#include <vector>
+
+#include "Engine/Math/Vec2.hpp"
+#include "Game/Collision/Broadphase.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Uniform grid broadphase over the XY plane. The world rectangle is split into square cells and
+// each proxy is listed in every cell its bounds touch; pairs are only tested within a cell. The
+// world is bounded, so a cell's index in the dense cell array is its hash and no bucket ever holds
+// two cells. Bounds beyond the world rectangle clamp into the border cells.
+//
+// Cells hold copies of their proxies' bounds, so the pair loop reads each cell as one contiguous
+// block instead of chasing proxy ids. MoveProxy() re-bins a proxy only when its covered cell range
+// changed; a small move just rewrites the bounds in the few cells it covers. A pair sharing several
+// cells is reported only from the cell holding the minimum corner of its overlap, which dedupes
+// without a pair set.
+//
+// Cell size should be around the size of a typical proxy: much smaller lists big proxies in many
+// cells, much larger puts many proxies in each cell. Cell and proxy storage comes from the given
+// memory resource, the game's GameArena, so the thousands of per-cell lists need no frees.
+//
+class SpatialHashGrid : public Broadphase
+{
+public:
+    SpatialHashGrid(const Vec2& worldMins, const Vec2& worldMaxs, float cellSize, std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    uint32_t AddProxy(const CollisionBounds& bounds, uint32_t userData) override;
+    void     MoveProxy(uint32_t proxyId, const CollisionBounds& bounds) override;
+    void     RemoveProxy(uint32_t proxyId) override;
+    void     FindPairs(std::vector<CollisionPair>& outPairs) override;
+    size_t   GetProxyCount() const override { return m_proxies.size() - m_freeProxies.size(); }
+
+    int GetCellCountX() const { return m_cellCountX; }
+    int GetCellCountY() const { return m_cellCountY; }
+    /// MoveProxy() calls that changed cells, since construction
+    size_t GetRebinCount() const { return m_rebinCount; }
+
+private:
+    struct CellRange
+    {
+        int m_minX = 0;
+        int m_minY = 0;
+        int m_maxX = -1;
+        int m_maxY = -1;
+
+        bool operator==(const CellRange& other) const
+        {
+            return m_minX == other.m_minX && m_minY == other.m_minY && m_maxX == other.m_maxX && m_maxY == other.m_maxY;
+        }
+    };
+
+    struct Proxy
+    {
+        CellRange m_cells;
+        uint32_t  m_userData = 0;
+        bool      m_isAlive  = false;
+    };
+
+    struct CellEntry
+    {
+        CollisionBounds m_bounds;
+        uint32_t        m_proxyId  = 0;
+        uint32_t        m_userData = 0;
+    };
+
+    int       GetCellX(float x) const;
+    int       GetCellY(float y) const;
+    CellRange GetCellRange(const CollisionBounds& bounds) const;
+    void      InsertIntoCells(uint32_t proxyId, const CollisionBounds& bounds, const CellRange& cells);
+    void      UpdateInCells(uint32_t proxyId, const CollisionBounds& bounds, const CellRange& cells);
+    void      RemoveFromCells(uint32_t proxyId, const CellRange& cells);
+
+    Vec2  m_worldMins;
+    float m_inverseCellSize = 1.f;
+    int   m_cellCountX      = 1;
+    int   m_cellCountY      = 1;
+
+    std::pmr::vector<std::pmr::vector<CellEntry>> m_cells; // Row-major, each cell allocates from the same resource
+    std::pmr::vector<Proxy>                       m_proxies;
+    std::pmr::vector<uint32_t>                    m_freeProxies;
+    size_t                                        m_rebinCount = 0;
+};
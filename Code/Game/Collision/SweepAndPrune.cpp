@@ -0,0 +1,126 @@
+#include "SweepAndPrune.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+SweepAndPrune::SweepAndPrune(int sweepAxis)
+    : m_sweepAxis(std::clamp(sweepAxis, 0, 2))
+{
+    m_otherAxisA = (m_sweepAxis + 1) % 3;
+    m_otherAxisB = (m_sweepAxis + 2) % 3;
+}
+
+uint32_t SweepAndPrune::AddProxy(const CollisionBounds& bounds, uint32_t userData)
+{
+    uint32_t proxyId;
+    if (!m_freeProxies.empty())
+    {
+        proxyId = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+    else
+    {
+        proxyId = static_cast<uint32_t>(m_userData.size());
+        m_sweepMins.push_back(0.f);
+        m_sweepMaxs.push_back(0.f);
+        m_otherMinsA.push_back(0.f);
+        m_otherMaxsA.push_back(0.f);
+        m_otherMinsB.push_back(0.f);
+        m_otherMaxsB.push_back(0.f);
+        m_userData.push_back(0);
+        m_isAlive.push_back(false);
+    }
+
+    SetBounds(proxyId, bounds);
+    m_userData[proxyId] = userData;
+    m_isAlive[proxyId]  = true;
+    m_sorted.push_back(proxyId); // The next FindPairs() sorts it into place
+    ++m_addedSinceSort;
+    return proxyId;
+}
+
+void SweepAndPrune::MoveProxy(uint32_t proxyId, const CollisionBounds& bounds)
+{
+    ASSERT_OR_DIE(m_isAlive[proxyId], "SweepAndPrune: MoveProxy on a removed proxy");
+    SetBounds(proxyId, bounds);
+}
+
+void SweepAndPrune::RemoveProxy(uint32_t proxyId)
+{
+    if (!m_isAlive[proxyId])
+    {
+        return;
+    }
+    // Dropped from m_sorted in the next FindPairs(), one pass for any number of removals. The id
+    // is only reused after that, or a re-add would put it in m_sorted twice.
+    m_isAlive[proxyId] = false;
+    m_removedProxies.push_back(proxyId);
+}
+
+void SweepAndPrune::FindPairs(std::vector<CollisionPair>& outPairs)
+{
+    outPairs.clear();
+    if (!m_removedProxies.empty())
+    {
+        m_sorted.erase(std::remove_if(m_sorted.begin(), m_sorted.end(), [this](uint32_t proxyId)
+        {
+            return !m_isAlive[proxyId];
+        }), m_sorted.end());
+        m_freeProxies.insert(m_freeProxies.end(), m_removedProxies.begin(), m_removedProxies.end());
+        m_removedProxies.clear();
+    }
+
+    if (m_addedSinceSort > MAX_INSERTION_SORT_ADDITIONS)
+    {
+        // Appended proxies can belong anywhere, too many for an insertion sort
+        std::sort(m_sorted.begin(), m_sorted.end(), [this](uint32_t proxyA, uint32_t proxyB)
+        {
+            return m_sweepMins[proxyA] < m_sweepMins[proxyB];
+        });
+    }
+    m_addedSinceSort = 0;
+
+    // Insertion sort: proxies only drift between frames, so each moves a few places at most
+    for (size_t i = 1; i < m_sorted.size(); ++i)
+    {
+        uint32_t proxyId = m_sorted[i];
+        float    sortKey = m_sweepMins[proxyId];
+        size_t   j       = i;
+        while (j > 0 && m_sweepMins[m_sorted[j - 1]] > sortKey)
+        {
+            m_sorted[j] = m_sorted[j - 1];
+            --j;
+        }
+        m_sorted[j] = proxyId;
+    }
+
+    for (size_t i = 0; i < m_sorted.size(); ++i)
+    {
+        uint32_t proxyA   = m_sorted[i];
+        float    sweepEnd = m_sweepMaxs[proxyA];
+        for (size_t j = i + 1; j < m_sorted.size(); ++j)
+        {
+            uint32_t proxyB = m_sorted[j];
+            if (m_sweepMins[proxyB] > sweepEnd)
+            {
+                break; // Everything after starts later still
+            }
+            if (m_otherMinsA[proxyA] <= m_otherMaxsA[proxyB] && m_otherMinsA[proxyB] <= m_otherMaxsA[proxyA] &&
+                m_otherMinsB[proxyA] <= m_otherMaxsB[proxyB] && m_otherMinsB[proxyB] <= m_otherMaxsB[proxyA])
+            {
+                outPairs.push_back({m_userData[proxyA], m_userData[proxyB]});
+            }
+        }
+    }
+}
+
+void SweepAndPrune::SetBounds(uint32_t proxyId, const CollisionBounds& bounds)
+{
+    m_sweepMins[proxyId]  = GetAxis(bounds.m_mins, m_sweepAxis);
+    m_sweepMaxs[proxyId]  = GetAxis(bounds.m_maxs, m_sweepAxis);
+    m_otherMinsA[proxyId] = GetAxis(bounds.m_mins, m_otherAxisA);
+    m_otherMaxsA[proxyId] = GetAxis(bounds.m_maxs, m_otherAxisA);
+    m_otherMinsB[proxyId] = GetAxis(bounds.m_mins, m_otherAxisB);
+    m_otherMaxsB[proxyId] = GetAxis(bounds.m_maxs, m_otherAxisB);
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+
+#include "Game/Collision/Broadphase.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Sort-and-sweep broadphase along one axis. Live proxies are kept sorted by their minimum on the
+// sweep axis; FindPairs() re-sorts with an insertion sort, which is close to linear because
+// proxies move little between frames, then sweeps once, testing each proxy only against those
+// whose interval starts before its own ends. A burst of additions gets a full sort instead, as
+// appended proxies can belong anywhere in the order.
+//
+// Suits elongated scenes where one axis spreads proxies out and a uniform grid would be mostly
+// empty cells. Pick the sweep axis along which the world is longest.
+//
+class SweepAndPrune : public Broadphase
+{
+public:
+    explicit SweepAndPrune(int sweepAxis = 0);
+
+    uint32_t AddProxy(const CollisionBounds& bounds, uint32_t userData) override;
+    void     MoveProxy(uint32_t proxyId, const CollisionBounds& bounds) override;
+    void     RemoveProxy(uint32_t proxyId) override;
+    void     FindPairs(std::vector<CollisionPair>& outPairs) override;
+    size_t   GetProxyCount() const override { return m_userData.size() - m_freeProxies.size() - m_removedProxies.size(); }
+
+private:
+    static constexpr size_t MAX_INSERTION_SORT_ADDITIONS = 64;
+
+    static float GetAxis(const Vec3& point, int axis) { return axis == 0 ? point.x : (axis == 1 ? point.y : point.z); }
+
+    void SetBounds(uint32_t proxyId, const CollisionBounds& bounds);
+
+    int m_sweepAxis  = 0;
+    int m_otherAxisA = 1;
+    int m_otherAxisB = 2;
+
+    // Per proxy id: the sweep interval and the two other intervals
+    std::vector<float>    m_sweepMins;
+    std::vector<float>    m_sweepMaxs;
+    std::vector<float>    m_otherMinsA;
+    std::vector<float>    m_otherMaxsA;
+    std::vector<float>    m_otherMinsB;
+    std::vector<float>    m_otherMaxsB;
+    std::vector<uint32_t> m_userData;
+    std::vector<bool>     m_isAlive;
+    std::vector<uint32_t> m_freeProxies;
+    std::vector<uint32_t> m_removedProxies; // Still in m_sorted, free for reuse once it is compacted
+
+    std::vector<uint32_t> m_sorted; // Live proxy ids by sweep minimum
+    size_t                m_addedSinceSort = 0;
+};
@@ -4,6 +4,7 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Math/EulerAngles.hpp"
+#include "Game/Transform.hpp"
 
 class Game;
 
@@ -16,13 +17,18 @@ public:
     virtual void Update(float deltaSeconds);
     virtual void Render() const = 0;
 
-    virtual Mat44 GetModelToWorldTransform() const;
+    /// Cached by m_transform, rebuilt only after the position, orientation, scale or parent changed
+    const Mat44& GetModelToWorldTransform() const { return m_transform.GetLocalToWorldMatrix(); }
+
+    const Vec3&        GetPosition() const { return m_transform.GetPosition(); }
+    const EulerAngles& GetOrientation() const { return m_transform.GetOrientation(); }
+    void               SetPosition(const Vec3& position) { m_transform.SetPosition(position); }
+    void               SetOrientation(const EulerAngles& orientation) { m_transform.SetOrientation(orientation); }
+    void               SetScale(const Vec3& scale) { m_transform.SetScale(scale); }
 
     Game*       m_game = nullptr;
-    Vec3        m_position;
+    Transform   m_transform;
     Vec3        m_velocity;
-    EulerAngles m_orientation;
-    Vec3        m_scale = Vec3(1, 1, 1);
     EulerAngles m_angularVelocity;
 
     Rgba8 m_color = Rgba8::WHITE;
@@ -0,0 +1,537 @@
+#include "EntityStore.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    template <typename T>
+    void MoveElement(std::pmr::vector<T>& column, size_t from, size_t to)
+    {
+        column[to] = column[from];
+    }
+
+    void MoveElement(Vec3Column& column, size_t from, size_t to)
+    {
+        column.m_x[to] = column.m_x[from];
+        column.m_y[to] = column.m_y[from];
+        column.m_z[to] = column.m_z[from];
+    }
+
+    void MoveElement(EulerAnglesColumn& column, size_t from, size_t to)
+    {
+        column.m_yawDegrees[to]   = column.m_yawDegrees[from];
+        column.m_pitchDegrees[to] = column.m_pitchDegrees[from];
+        column.m_rollDegrees[to]  = column.m_rollDegrees[from];
+    }
+
+    void ReserveColumn(Vec3Column& column, size_t count)
+    {
+        column.m_x.reserve(count);
+        column.m_y.reserve(count);
+        column.m_z.reserve(count);
+    }
+
+    void ReserveColumn(EulerAnglesColumn& column, size_t count)
+    {
+        column.m_yawDegrees.reserve(count);
+        column.m_pitchDegrees.reserve(count);
+        column.m_rollDegrees.reserve(count);
+    }
+
+    void PushBack(Vec3Column& column, const Vec3& value)
+    {
+        column.m_x.push_back(value.x);
+        column.m_y.push_back(value.y);
+        column.m_z.push_back(value.z);
+    }
+
+    void PushBack(EulerAnglesColumn& column, const EulerAngles& value)
+    {
+        column.m_yawDegrees.push_back(value.m_yawDegrees);
+        column.m_pitchDegrees.push_back(value.m_pitchDegrees);
+        column.m_rollDegrees.push_back(value.m_rollDegrees);
+    }
+
+    void PopBack(Vec3Column& column)
+    {
+        column.m_x.pop_back();
+        column.m_y.pop_back();
+        column.m_z.pop_back();
+    }
+
+    void PopBack(EulerAnglesColumn& column)
+    {
+        column.m_yawDegrees.pop_back();
+        column.m_pitchDegrees.pop_back();
+        column.m_rollDegrees.pop_back();
+    }
+
+    /// Keeps the elements whose flags lack FLAG_DEAD, in order, and returns how many were kept
+    template <typename T>
+    size_t CompactColumn(std::pmr::vector<T>& column, const std::pmr::vector<uint8_t>& flags, uint8_t deadFlag)
+    {
+        size_t liveCount = 0;
+        for (size_t i = 0; i < column.size(); ++i)
+        {
+            if ((flags[i] & deadFlag) == 0)
+            {
+                column[liveCount++] = column[i];
+            }
+        }
+        column.resize(liveCount);
+        return liveCount;
+    }
+
+    void CompactColumn(Vec3Column& column, const std::pmr::vector<uint8_t>& flags, uint8_t deadFlag)
+    {
+        CompactColumn(column.m_x, flags, deadFlag);
+        CompactColumn(column.m_y, flags, deadFlag);
+        CompactColumn(column.m_z, flags, deadFlag);
+    }
+
+    void CompactColumn(EulerAnglesColumn& column, const std::pmr::vector<uint8_t>& flags, uint8_t deadFlag)
+    {
+        CompactColumn(column.m_yawDegrees, flags, deadFlag);
+        CompactColumn(column.m_pitchDegrees, flags, deadFlag);
+        CompactColumn(column.m_rollDegrees, flags, deadFlag);
+    }
+
+    void CopyRange(const Vec3Column& from, Vec3Column& to, size_t begin, size_t end)
+    {
+        std::copy(from.m_x.begin() + begin, from.m_x.begin() + end, to.m_x.begin() + begin);
+        std::copy(from.m_y.begin() + begin, from.m_y.begin() + end, to.m_y.begin() + begin);
+        std::copy(from.m_z.begin() + begin, from.m_z.begin() + end, to.m_z.begin() + begin);
+    }
+
+    void CopyRange(const EulerAnglesColumn& from, EulerAnglesColumn& to, size_t begin, size_t end)
+    {
+        std::copy(from.m_yawDegrees.begin() + begin, from.m_yawDegrees.begin() + end, to.m_yawDegrees.begin() + begin);
+        std::copy(from.m_pitchDegrees.begin() + begin, from.m_pitchDegrees.begin() + end, to.m_pitchDegrees.begin() + begin);
+        std::copy(from.m_rollDegrees.begin() + begin, from.m_rollDegrees.begin() + end, to.m_rollDegrees.begin() + begin);
+    }
+
+    void ClearColumn(Vec3Column& column)
+    {
+        column.m_x.clear();
+        column.m_y.clear();
+        column.m_z.clear();
+    }
+
+    void ClearColumn(EulerAnglesColumn& column)
+    {
+        column.m_yawDegrees.clear();
+        column.m_pitchDegrees.clear();
+        column.m_rollDegrees.clear();
+    }
+}
+
+EntityStore::EntityStore(std::pmr::memory_resource* memory)
+    : m_positions(memory)
+    , m_velocities(memory)
+    , m_scales(memory)
+    , m_orientations(memory)
+    , m_previousPositions(memory)
+    , m_previousOrientations(memory)
+    , m_angularVelocities(memory)
+    , m_colors(memory)
+    , m_meshIds(memory)
+    , m_flags(memory)
+    , m_worldTransforms(memory)
+    , m_denseToSlot(memory)
+    , m_slotToDense(memory)
+    , m_slotGenerations(memory)
+    , m_freeSlots(memory)
+{
+}
+
+void Vec3Column::Set(size_t index, const Vec3& value)
+{
+    m_x[index] = value.x;
+    m_y[index] = value.y;
+    m_z[index] = value.z;
+}
+
+void EulerAnglesColumn::Set(size_t index, const EulerAngles& value)
+{
+    m_yawDegrees[index]   = value.m_yawDegrees;
+    m_pitchDegrees[index] = value.m_pitchDegrees;
+    m_rollDegrees[index]  = value.m_rollDegrees;
+}
+
+void EntityStore::Reserve(size_t count)
+{
+    ReserveColumn(m_positions, count);
+    ReserveColumn(m_velocities, count);
+    ReserveColumn(m_scales, count);
+    ReserveColumn(m_orientations, count);
+    ReserveColumn(m_previousPositions, count);
+    ReserveColumn(m_previousOrientations, count);
+    ReserveColumn(m_angularVelocities, count);
+    m_colors.reserve(count);
+    m_meshIds.reserve(count);
+    m_flags.reserve(count);
+    m_worldTransforms.reserve(count);
+    m_denseToSlot.reserve(count);
+    m_slotToDense.reserve(count);
+    m_slotGenerations.reserve(count);
+}
+
+EntityHandle EntityStore::Create(const Vec3& position, uint16_t meshId)
+{
+    uint32_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_slotToDense.size());
+        m_slotToDense.push_back(EntityHandle::INVALID_INDEX);
+        m_slotGenerations.push_back(0);
+    }
+
+    m_slotToDense[slot] = static_cast<uint32_t>(m_denseToSlot.size());
+    m_denseToSlot.push_back(slot);
+    PushBack(m_positions, position);
+    PushBack(m_velocities, Vec3());
+    PushBack(m_scales, Vec3(1.f, 1.f, 1.f));
+    PushBack(m_orientations, EulerAngles());
+    PushBack(m_previousPositions, position);
+    PushBack(m_previousOrientations, EulerAngles());
+    PushBack(m_angularVelocities, EulerAngles());
+    m_colors.push_back(Rgba8::WHITE);
+    m_meshIds.push_back(meshId);
+    m_flags.push_back(FLAG_TRANSFORM_DIRTY);
+    m_worldTransforms.emplace_back();
+
+    EntityHandle handle;
+    handle.m_index      = slot;
+    handle.m_generation = m_slotGenerations[slot];
+    return handle;
+}
+
+void EntityStore::Destroy(EntityHandle handle)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex == EntityHandle::INVALID_INDEX)
+    {
+        return;
+    }
+
+    size_t lastIndex = GetCount() - 1;
+    if (denseIndex != lastIndex)
+    {
+        MoveDense(lastIndex, denseIndex);
+        m_slotToDense[m_denseToSlot[denseIndex]] = denseIndex;
+    }
+    PopBackDense();
+
+    m_slotToDense[handle.m_index] = EntityHandle::INVALID_INDEX;
+    ++m_slotGenerations[handle.m_index];
+    m_freeSlots.push_back(handle.m_index);
+}
+
+void EntityStore::Kill(EntityHandle handle)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex == EntityHandle::INVALID_INDEX)
+    {
+        return;
+    }
+    // The generation moves on now so the handle is stale from here; the slot is freed on collection
+    ++m_slotGenerations[handle.m_index];
+    m_flags[denseIndex] |= FLAG_DEAD;
+    ++m_deadCount;
+}
+
+size_t EntityStore::CollectDead()
+{
+    if (m_deadCount == 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < GetCount(); ++i)
+    {
+        if ((m_flags[i] & FLAG_DEAD) != 0)
+        {
+            m_slotToDense[m_denseToSlot[i]] = EntityHandle::INVALID_INDEX;
+            m_freeSlots.push_back(m_denseToSlot[i]);
+        }
+    }
+
+    // Column by column, so each pass streams one array; the flags column goes last as the others read it
+    CompactColumn(m_positions, m_flags, FLAG_DEAD);
+    CompactColumn(m_velocities, m_flags, FLAG_DEAD);
+    CompactColumn(m_scales, m_flags, FLAG_DEAD);
+    CompactColumn(m_orientations, m_flags, FLAG_DEAD);
+    CompactColumn(m_previousPositions, m_flags, FLAG_DEAD);
+    CompactColumn(m_previousOrientations, m_flags, FLAG_DEAD);
+    CompactColumn(m_angularVelocities, m_flags, FLAG_DEAD);
+    CompactColumn(m_colors, m_flags, FLAG_DEAD);
+    CompactColumn(m_meshIds, m_flags, FLAG_DEAD);
+    CompactColumn(m_worldTransforms, m_flags, FLAG_DEAD);
+    size_t liveCount = CompactColumn(m_denseToSlot, m_flags, FLAG_DEAD);
+    CompactColumn(m_flags, m_flags, FLAG_DEAD);
+
+    for (size_t i = 0; i < liveCount; ++i)
+    {
+        m_slotToDense[m_denseToSlot[i]] = static_cast<uint32_t>(i);
+    }
+
+    size_t collected = m_deadCount;
+    m_deadCount      = 0;
+    return collected;
+}
+
+void EntityStore::Clear()
+{
+    // Every live slot's generation moves on so outstanding handles go stale
+    for (uint32_t slot : m_denseToSlot)
+    {
+        m_slotToDense[slot] = EntityHandle::INVALID_INDEX;
+        ++m_slotGenerations[slot];
+        m_freeSlots.push_back(slot);
+    }
+    ClearColumn(m_positions);
+    ClearColumn(m_velocities);
+    ClearColumn(m_scales);
+    ClearColumn(m_orientations);
+    ClearColumn(m_previousPositions);
+    ClearColumn(m_previousOrientations);
+    ClearColumn(m_angularVelocities);
+    m_colors.clear();
+    m_meshIds.clear();
+    m_flags.clear();
+    m_worldTransforms.clear();
+    m_denseToSlot.clear();
+    m_deadCount = 0;
+}
+
+bool EntityStore::IsAlive(EntityHandle handle) const
+{
+    return GetDenseIndex(handle) != EntityHandle::INVALID_INDEX;
+}
+
+uint32_t EntityStore::GetDenseIndex(EntityHandle handle) const
+{
+    if (handle.m_index >= m_slotToDense.size() || m_slotGenerations[handle.m_index] != handle.m_generation)
+    {
+        return EntityHandle::INVALID_INDEX;
+    }
+    return m_slotToDense[handle.m_index];
+}
+
+EntityHandle EntityStore::GetHandle(uint32_t denseIndex) const
+{
+    EntityHandle handle;
+    if (denseIndex < GetCount() && (m_flags[denseIndex] & FLAG_DEAD) == 0)
+    {
+        handle.m_index      = m_denseToSlot[denseIndex];
+        handle.m_generation = m_slotGenerations[handle.m_index];
+    }
+    return handle;
+}
+
+Vec3 EntityStore::GetPosition(EntityHandle handle) const
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    return denseIndex != EntityHandle::INVALID_INDEX ? m_positions.Get(denseIndex) : Vec3();
+}
+
+EulerAngles EntityStore::GetOrientation(EntityHandle handle) const
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    return denseIndex != EntityHandle::INVALID_INDEX ? m_orientations.Get(denseIndex) : EulerAngles();
+}
+
+void EntityStore::SetPosition(EntityHandle handle, const Vec3& position)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_positions.Set(denseIndex, position);
+        m_previousPositions.Set(denseIndex, position); // Teleport, nothing to interpolate from
+        m_flags[denseIndex] |= FLAG_TRANSFORM_DIRTY;
+    }
+}
+
+void EntityStore::SetOrientation(EntityHandle handle, const EulerAngles& orientation)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_orientations.Set(denseIndex, orientation);
+        m_previousOrientations.Set(denseIndex, orientation);
+        m_flags[denseIndex] |= FLAG_TRANSFORM_DIRTY;
+    }
+}
+
+void EntityStore::SetScale(EntityHandle handle, const Vec3& scale)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_scales.Set(denseIndex, scale);
+        m_flags[denseIndex] |= FLAG_TRANSFORM_DIRTY;
+    }
+}
+
+void EntityStore::SetVelocity(EntityHandle handle, const Vec3& velocity)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_velocities.Set(denseIndex, velocity);
+    }
+}
+
+void EntityStore::SetAngularVelocity(EntityHandle handle, const EulerAngles& angularVelocity)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_angularVelocities.Set(denseIndex, angularVelocity);
+    }
+}
+
+void EntityStore::SetColor(EntityHandle handle, const Rgba8& color)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex != EntityHandle::INVALID_INDEX)
+    {
+        m_colors[denseIndex] = color;
+    }
+}
+
+void EntityStore::SetHidden(EntityHandle handle, bool isHidden)
+{
+    uint32_t denseIndex = GetDenseIndex(handle);
+    if (denseIndex == EntityHandle::INVALID_INDEX)
+    {
+        return;
+    }
+    if (isHidden)
+    {
+        m_flags[denseIndex] |= FLAG_HIDDEN;
+    }
+    else
+    {
+        m_flags[denseIndex] &= static_cast<uint8_t>(~FLAG_HIDDEN);
+    }
+}
+
+void EntityStore::IntegrateRange(size_t begin, size_t end, float deltaSeconds)
+{
+    // This step's starting state is what render interpolation blends from
+    CopyRange(m_positions, m_previousPositions, begin, end);
+    CopyRange(m_orientations, m_previousOrientations, begin, end);
+
+    // One pass per column: each loop streams three float arrays and compiles to packed SIMD
+    float*       positionX = m_positions.m_x.data();
+    float*       positionY = m_positions.m_y.data();
+    float*       positionZ = m_positions.m_z.data();
+    const float* velocityX = m_velocities.m_x.data();
+    const float* velocityY = m_velocities.m_y.data();
+    const float* velocityZ = m_velocities.m_z.data();
+    for (size_t i = begin; i < end; ++i)
+    {
+        positionX[i] += velocityX[i] * deltaSeconds;
+        positionY[i] += velocityY[i] * deltaSeconds;
+        positionZ[i] += velocityZ[i] * deltaSeconds;
+    }
+
+    float*       yaw       = m_orientations.m_yawDegrees.data();
+    float*       pitch     = m_orientations.m_pitchDegrees.data();
+    float*       roll      = m_orientations.m_rollDegrees.data();
+    const float* yawRate   = m_angularVelocities.m_yawDegrees.data();
+    const float* pitchRate  = m_angularVelocities.m_pitchDegrees.data();
+    const float* rollRate   = m_angularVelocities.m_rollDegrees.data();
+    for (size_t i = begin; i < end; ++i)
+    {
+        yaw[i] += yawRate[i] * deltaSeconds;
+        pitch[i] += pitchRate[i] * deltaSeconds;
+        roll[i] += rollRate[i] * deltaSeconds;
+    }
+
+    // Anything with a nonzero velocity moved and interpolates until a step where it does not; that
+    // step still dirties it once so its transform settles on the final state
+    uint8_t* flags = m_flags.data();
+    for (size_t i = begin; i < end; ++i)
+    {
+        bool isMoving = (velocityX[i] != 0.f) | (velocityY[i] != 0.f) | (velocityZ[i] != 0.f) |
+                        (yawRate[i] != 0.f) | (pitchRate[i] != 0.f) | (rollRate[i] != 0.f);
+        uint8_t wasMoving = flags[i] & FLAG_INTERPOLATED;
+        flags[i] &= static_cast<uint8_t>(~FLAG_INTERPOLATED);
+        flags[i] |= static_cast<uint8_t>((isMoving ? FLAG_TRANSFORM_DIRTY | FLAG_INTERPOLATED : 0) | (wasMoving ? FLAG_TRANSFORM_DIRTY : 0));
+    }
+}
+
+void EntityStore::UpdateWorldTransformsRange(size_t begin, size_t end, float alpha)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        uint8_t flags = m_flags[i];
+        if ((flags & FLAG_TRANSFORM_DIRTY) == 0)
+        {
+            continue;
+        }
+
+        Vec3        position    = m_positions.Get(i);
+        EulerAngles orientation = m_orientations.Get(i);
+        if ((flags & FLAG_INTERPOLATED) != 0)
+        {
+            // Angles are integrated without wrapping, so a straight blend never takes the long way round
+            Vec3        previousPosition    = m_previousPositions.Get(i);
+            EulerAngles previousOrientation = m_previousOrientations.Get(i);
+            position                        = previousPosition + (position - previousPosition) * alpha;
+            orientation                     = EulerAngles(previousOrientation.m_yawDegrees + (orientation.m_yawDegrees - previousOrientation.m_yawDegrees) * alpha,
+                                                          previousOrientation.m_pitchDegrees + (orientation.m_pitchDegrees - previousOrientation.m_pitchDegrees) * alpha,
+                                                          previousOrientation.m_rollDegrees + (orientation.m_rollDegrees - previousOrientation.m_rollDegrees) * alpha);
+        }
+
+        Mat44& worldTransform = m_worldTransforms[i];
+        worldTransform        = Mat44::MakeTranslation3D(position);
+        worldTransform.Append(orientation.GetAsMatrix_IFwd_JLeft_KUp());
+        worldTransform.Append(Mat44::MakeNonUniformScale3D(m_scales.Get(i)));
+
+        // Interpolating entities change with alpha every frame until their next step, keep them dirty
+        if ((flags & FLAG_INTERPOLATED) == 0)
+        {
+            m_flags[i] = flags & static_cast<uint8_t>(~FLAG_TRANSFORM_DIRTY);
+        }
+    }
+}
+
+void EntityStore::MoveDense(size_t from, size_t to)
+{
+    MoveElement(m_positions, from, to);
+    MoveElement(m_velocities, from, to);
+    MoveElement(m_scales, from, to);
+    MoveElement(m_orientations, from, to);
+    MoveElement(m_previousPositions, from, to);
+    MoveElement(m_previousOrientations, from, to);
+    MoveElement(m_angularVelocities, from, to);
+    MoveElement(m_colors, from, to);
+    MoveElement(m_meshIds, from, to);
+    MoveElement(m_flags, from, to);
+    MoveElement(m_worldTransforms, from, to);
+    MoveElement(m_denseToSlot, from, to);
+}
+
+void EntityStore::PopBackDense()
+{
+    PopBack(m_positions);
+    PopBack(m_velocities);
+    PopBack(m_scales);
+    PopBack(m_orientations);
+    PopBack(m_previousPositions);
+    PopBack(m_previousOrientations);
+    PopBack(m_angularVelocities);
+    m_colors.pop_back();
+    m_meshIds.pop_back();
+    m_flags.pop_back();
+    m_worldTransforms.pop_back();
+    m_denseToSlot.pop_back();
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+/// Refers to one entity of an EntityStore. A handle goes stale when its entity is destroyed, even
+/// if the slot is reused, because the slot's generation moves on.
+struct EntityHandle
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t m_index      = INVALID_INDEX;
+    uint32_t m_generation = 0;
+
+    bool IsValid() const { return m_index != INVALID_INDEX; }
+    bool operator==(const EntityHandle& other) const { return m_index == other.m_index && m_generation == other.m_generation; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+/// One float array per component, so a sweep over one axis is a contiguous stream
+struct Vec3Column
+{
+    explicit Vec3Column(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : m_x(memory), m_y(memory), m_z(memory)
+    {
+    }
+
+    std::pmr::vector<float> m_x;
+    std::pmr::vector<float> m_y;
+    std::pmr::vector<float> m_z;
+
+    Vec3 Get(size_t index) const { return Vec3(m_x[index], m_y[index], m_z[index]); }
+    void Set(size_t index, const Vec3& value);
+};
+
+struct EulerAnglesColumn
+{
+    explicit EulerAnglesColumn(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : m_yawDegrees(memory), m_pitchDegrees(memory), m_rollDegrees(memory)
+    {
+    }
+
+    std::pmr::vector<float> m_yawDegrees;
+    std::pmr::vector<float> m_pitchDegrees;
+    std::pmr::vector<float> m_rollDegrees;
+
+    EulerAngles Get(size_t index) const { return EulerAngles(m_yawDegrees[index], m_pitchDegrees[index], m_rollDegrees[index]); }
+    void        Set(size_t index, const EulerAngles& value);
+};
+
+//-----------------------------------------------------------------------------------------------
+// Structure-of-arrays storage for simple world entities: every attribute lives in its own
+// contiguous column, and the live entities are packed at the front of every column so systems are
+// linear sweeps over [0, GetCount()). Handles map to the packed (dense) index through a slot table;
+// destroying an entity moves the last entity into its place.
+//
+// Kill() defers destruction: the handle goes stale at once, but the entity keeps its dense slot,
+// flagged FLAG_DEAD, until CollectDead() compacts every column in one linear pass. A burst of
+// deaths costs one sweep instead of a scattered swap-remove each, and the freed slots and column
+// capacity are reused by later Create() calls.
+//
+// Every column allocates from the memory resource given at construction; the game passes its
+// GameArena so a restart drops all entity storage with one arena reset.
+//
+// The world transform of each entity is cached and rebuilt by UpdateWorldTransforms() only for
+// entities whose position, orientation or scale changed since the last rebuild. Integrate() runs
+// at the fixed simulation rate and keeps each entity's pre-step position and orientation, so the
+// per-frame rebuild can blend moving entities between the last two steps; SetPosition() and
+// SetOrientation() teleport, resetting both states.
+//
+class EntityStore
+{
+public:
+    static constexpr uint16_t NO_MESH = 0xFFFF;
+
+    enum Flags : uint8_t
+    {
+        FLAG_TRANSFORM_DIRTY = 1 << 0,
+        FLAG_HIDDEN          = 1 << 1,
+        FLAG_DEAD            = 1 << 2, // Killed, still occupies its dense index until CollectDead()
+        FLAG_INTERPOLATED    = 1 << 3, // Moved in the last Integrate(), world transform blends from the previous state
+    };
+
+    explicit EntityStore(std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    EntityStore(const EntityStore&)            = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    void Reserve(size_t count);
+
+    EntityHandle Create(const Vec3& position = Vec3(), uint16_t meshId = NO_MESH);
+    void         Destroy(EntityHandle handle);
+    void         Kill(EntityHandle handle);
+    /// Removes every killed entity, keeping the survivors in order; returns how many were removed
+    size_t       CollectDead();
+    void         Clear();
+    bool         IsAlive(EntityHandle handle) const;
+
+    /// Dense index of a live entity, EntityHandle::INVALID_INDEX for a stale handle
+    uint32_t     GetDenseIndex(EntityHandle handle) const;
+    EntityHandle GetHandle(uint32_t denseIndex) const;
+    size_t       GetCount() const { return m_denseToSlot.size(); }
+    size_t       GetDeadCount() const { return m_deadCount; }
+
+    /// Per-entity access by handle, stale handles are ignored on set and read as defaults
+    Vec3        GetPosition(EntityHandle handle) const;
+    EulerAngles GetOrientation(EntityHandle handle) const;
+    void        SetPosition(EntityHandle handle, const Vec3& position);
+    void        SetOrientation(EntityHandle handle, const EulerAngles& orientation);
+    void        SetScale(EntityHandle handle, const Vec3& scale);
+    void        SetVelocity(EntityHandle handle, const Vec3& velocity);
+    void        SetAngularVelocity(EntityHandle handle, const EulerAngles& angularVelocity);
+    void        SetColor(EntityHandle handle, const Rgba8& color);
+    void        SetHidden(EntityHandle handle, bool isHidden);
+
+    /// Advances position by velocity and orientation by angular velocity for dense [begin, end),
+    /// keeping the state from before the step for interpolation
+    void IntegrateRange(size_t begin, size_t end, float deltaSeconds);
+    void Integrate(float deltaSeconds) { IntegrateRange(0, GetCount(), deltaSeconds); }
+    /// Rebuilds the cached world transform of every entity flagged dirty in dense [begin, end). Entities
+    /// that moved in the last step are placed alpha of the way from their previous to their current state.
+    void UpdateWorldTransformsRange(size_t begin, size_t end, float alpha = 1.f);
+    void UpdateWorldTransforms(float alpha = 1.f) { UpdateWorldTransformsRange(0, GetCount(), alpha); }
+
+    /// Read-only columns for systems, indexed by dense index
+    const Vec3Column&            GetPositions() const { return m_positions; }
+    const Vec3Column&            GetScales() const { return m_scales; }
+    const std::pmr::vector<Rgba8>&    GetColors() const { return m_colors; }
+    const std::pmr::vector<uint16_t>& GetMeshIds() const { return m_meshIds; }
+    const std::pmr::vector<uint8_t>&  GetFlags() const { return m_flags; }
+    const std::pmr::vector<Mat44>&    GetWorldTransforms() const { return m_worldTransforms; }
+
+private:
+    /// Moves the entity at dense index from to dense index to in every column
+    void MoveDense(size_t from, size_t to);
+    void PopBackDense();
+
+    // Columns, all GetCount() long
+    Vec3Column            m_positions;
+    Vec3Column            m_velocities;
+    Vec3Column            m_scales;
+    EulerAnglesColumn     m_orientations;
+    Vec3Column            m_previousPositions;    // State before the last Integrate(), for interpolation
+    EulerAnglesColumn     m_previousOrientations;
+    EulerAnglesColumn     m_angularVelocities;
+    std::pmr::vector<Rgba8>    m_colors;
+    std::pmr::vector<uint16_t> m_meshIds;
+    std::pmr::vector<uint8_t>  m_flags;
+    std::pmr::vector<Mat44>    m_worldTransforms;
+    std::pmr::vector<uint32_t> m_denseToSlot;
+
+    // Slot table, indexed by EntityHandle::m_index
+    std::pmr::vector<uint32_t> m_slotToDense;
+    std::pmr::vector<uint32_t> m_slotGenerations;
+    std::pmr::vector<uint32_t> m_freeSlots;
+    size_t                m_deadCount = 0;
+};
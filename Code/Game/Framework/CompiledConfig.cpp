@@ -0,0 +1,124 @@
+#include "CompiledConfig.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Yaml.hpp"
+
+CompiledConfig CompiledConfig::LoadFromFile(const std::string& filePath)
+{
+    try
+    {
+        return FromNode(YAML::LoadFile(filePath));
+    }
+    catch (const YAML::Exception& exception)
+    {
+        DebuggerPrintf("[CONFIG]    Failed to compile config \"%s\": %s\n", filePath.c_str(), exception.what());
+        return CompiledConfig();
+    }
+}
+
+CompiledConfig CompiledConfig::FromNode(const YAML::Node& root)
+{
+    CompiledConfig config;
+    std::string    path;
+    path.reserve(128);
+    config.Flatten(root, path);
+    config.m_isLoaded = true;
+    return config;
+}
+
+const CompiledConfig::Value* CompiledConfig::Find(ConfigKey key) const
+{
+    auto found = m_values.find(key.m_hash);
+    return found != m_values.end() ? &found->second : nullptr;
+}
+
+std::string CompiledConfig::GetString(ConfigKey key, const char* defaultValue) const
+{
+    const Value* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_STRING) ? value->m_string : std::string(defaultValue);
+}
+
+int CompiledConfig::GetInt(ConfigKey key, int defaultValue) const
+{
+    const Value* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_INT) ? static_cast<int>(value->m_int) : defaultValue;
+}
+
+float CompiledConfig::GetFloat(ConfigKey key, float defaultValue) const
+{
+    const Value* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_FLOAT) ? static_cast<float>(value->m_float) : defaultValue;
+}
+
+bool CompiledConfig::GetBool(ConfigKey key, bool defaultValue) const
+{
+    const Value* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_BOOL) ? value->m_bool : defaultValue;
+}
+
+int CompiledConfig::GetSequenceLength(ConfigKey key) const
+{
+    const Value* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_SEQUENCE) ? static_cast<int>(value->m_int) : 0;
+}
+
+void CompiledConfig::Flatten(const YAML::Node& node, std::string& path)
+{
+    switch (node.Type())
+    {
+    case YAML::NodeType::Map:
+        {
+            Value mapValue;
+            mapValue.m_types = ConfigValue::TYPE_MAP;
+            mapValue.m_int   = static_cast<int64_t>(node.size());
+            if (!path.empty())
+            {
+                Insert(path, std::move(mapValue));
+            }
+            for (auto it = node.begin(); it != node.end(); ++it)
+            {
+                size_t parentLength = path.size();
+                if (!path.empty())
+                {
+                    path += '.';
+                }
+                path += it->first.Scalar();
+                Flatten(it->second, path);
+                path.resize(parentLength);
+            }
+            break;
+        }
+    case YAML::NodeType::Sequence:
+        {
+            Value sequenceValue;
+            sequenceValue.m_types = ConfigValue::TYPE_SEQUENCE;
+            sequenceValue.m_int   = static_cast<int64_t>(node.size());
+            Insert(path, std::move(sequenceValue));
+            for (size_t index = 0; index < node.size(); ++index)
+            {
+                size_t parentLength = path.size();
+                path += '.';
+                path += std::to_string(index);
+                Flatten(node[index], path);
+                path.resize(parentLength);
+            }
+            break;
+        }
+    case YAML::NodeType::Scalar:
+        Insert(path, ConfigValue::Parse(node.Scalar()));
+        break;
+    default:
+        // Null / undefined: record the key so Contains() reports it, but with no readable type
+        Insert(path, Value());
+        break;
+    }
+}
+
+void CompiledConfig::Insert(const std::string& path, Value&& value)
+{
+    auto [it, inserted] = m_values.emplace(HashString64(path), std::move(value));
+    if (!inserted)
+    {
+        DebuggerPrintf("[CONFIG]    Duplicate or colliding config path \"%s\"\n", path.c_str());
+    }
+}
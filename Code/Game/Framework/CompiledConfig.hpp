@@ -0,0 +1,95 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "Game/Framework/ConfigValue.hpp"
+#include "Game/Framework/StringHash.hpp"
+
+namespace YAML
+{
+    class Node;
+}
+
+//-----------------------------------------------------------------------------------------------
+// Read-only, precompiled view of a YAML document. On load every scalar is flattened into a hash map
+// keyed by the FNV-1a hash of its dotted path ("moduleConfig.logger.globalLogLevel") and parsed once
+// into every type it can represent. GetString/GetInt/GetFloat/GetBool then cost one hash probe.
+//
+// Sequences flatten by index ("engine.modules.0") and the sequence node itself stores its length.
+//
+// For values read every frame, bind a ConfigValueHandle once; reading through it is a plain load.
+// Handles point into this config and must not outlive it.
+//
+using ConfigKey = HashedName;
+
+class CompiledConfig
+{
+public:
+    using Value = ConfigValue;
+
+    CompiledConfig() = default;
+
+    static CompiledConfig LoadFromFile(const std::string& filePath);
+    static CompiledConfig FromNode(const YAML::Node& root);
+
+    bool         IsLoaded() const { return m_isLoaded; }
+    size_t       GetValueCount() const { return m_values.size(); }
+    bool         Contains(ConfigKey key) const { return Find(key) != nullptr; }
+    const Value* Find(ConfigKey key) const;
+
+    /// Returns a copy, so a temporary default is safe. Find() reads the stored string without one.
+    std::string GetString(ConfigKey key, const char* defaultValue = "") const;
+    int         GetInt(ConfigKey key, int defaultValue = 0) const;
+    float       GetFloat(ConfigKey key, float defaultValue = 0.f) const;
+    bool        GetBool(ConfigKey key, bool defaultValue = false) const;
+    int         GetSequenceLength(ConfigKey key) const;
+
+private:
+    void Flatten(const YAML::Node& node, std::string& path);
+    void Insert(const std::string& path, Value&& value);
+
+    std::unordered_map<uint64_t, Value, PrehashedKeyHasher> m_values;
+    bool                                                    m_isLoaded = false;
+};
+
+/// Pre-resolved accessor, bind once (e.g. in a constructor) and read every frame without hashing.
+template <typename T>
+class ConfigValueHandle
+{
+public:
+    ConfigValueHandle() = default;
+
+    ConfigValueHandle(const CompiledConfig& config, ConfigKey key, T defaultValue)
+        : m_value(config.Find(key)), m_default(std::move(defaultValue))
+    {
+    }
+
+    bool IsBound() const { return m_value != nullptr; }
+
+    T Get() const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return m_value && m_value->Is(ConfigValue::TYPE_BOOL) ? m_value->m_bool : m_default;
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            return m_value && m_value->Is(ConfigValue::TYPE_INT) ? static_cast<T>(m_value->m_int) : m_default;
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return m_value && m_value->Is(ConfigValue::TYPE_FLOAT) ? static_cast<T>(m_value->m_float) : m_default;
+        }
+        else
+        {
+            return m_value && m_value->Is(ConfigValue::TYPE_STRING) ? T(m_value->m_string) : m_default;
+        }
+    }
+
+private:
+    const CompiledConfig::Value* m_value = nullptr;
+    T                            m_default{};
+};
@@ -0,0 +1,68 @@
+#include "ConfigValue.hpp"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+    bool ParseBool(const std::string& text, bool& outValue)
+    {
+        if (text == "true" || text == "True" || text == "TRUE" || text == "yes" || text == "on")
+        {
+            outValue = true;
+            return true;
+        }
+        if (text == "false" || text == "False" || text == "FALSE" || text == "no" || text == "off")
+        {
+            outValue = false;
+            return true;
+        }
+        return false;
+    }
+}
+
+ConfigValue ConfigValue::Parse(std::string_view text)
+{
+    ConfigValue value;
+    value.m_string = std::string(text);
+    value.m_types  = TYPE_STRING;
+
+    if (ParseBool(value.m_string, value.m_bool))
+    {
+        value.m_types |= TYPE_BOOL;
+        return value;
+    }
+    if (value.m_string.empty())
+    {
+        return value;
+    }
+
+    const char* begin = value.m_string.c_str();
+    char*       end   = nullptr;
+
+    errno           = 0;
+    long long asInt = std::strtoll(begin, &end, 10);
+    if (errno == 0 && *end == '\0')
+    {
+        value.m_int   = asInt;
+        value.m_float = static_cast<double>(asInt);
+        value.m_types |= TYPE_INT | TYPE_FLOAT;
+        return value;
+    }
+
+    errno          = 0;
+    double asFloat = std::strtod(begin, &end);
+    if (errno == 0 && *end == '\0')
+    {
+        value.m_float = asFloat;
+        value.m_types |= TYPE_FLOAT;
+        // "1600.0" is a whole number too, readable as int like "1600"
+        if (std::trunc(asFloat) == asFloat && std::fabs(asFloat) < 9.0e18)
+        {
+            value.m_int = static_cast<int64_t>(asFloat);
+            value.m_types |= TYPE_INT;
+        }
+    }
+    return value;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+//-----------------------------------------------------------------------------------------------
+// A config scalar parsed once into every type it can represent. "1600" and "1600.0" are readable as
+// string, int and float; "0.03" as string and float; "true" as string and bool.
+//
+struct ConfigValue
+{
+    enum TypeFlags : uint8_t
+    {
+        TYPE_STRING   = 1 << 0,
+        TYPE_BOOL     = 1 << 1,
+        TYPE_INT      = 1 << 2,
+        TYPE_FLOAT    = 1 << 3,
+        TYPE_SEQUENCE = 1 << 4,
+        TYPE_MAP      = 1 << 5,
+    };
+
+    static ConfigValue Parse(std::string_view text);
+
+    bool Is(TypeFlags type) const { return (m_types & type) != 0; }
+
+    std::string m_string;
+    double      m_float = 0.0;
+    int64_t     m_int   = 0;
+    bool        m_bool  = false;
+    uint8_t     m_types = 0;
+};
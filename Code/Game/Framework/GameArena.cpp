@@ -0,0 +1,71 @@
+#include "GameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Game/Framework/MemoryTracker.hpp"
+
+GameArena::GameArena(size_t blockSize)
+    : m_blockSize(std::max<size_t>(blockSize, 4096))
+{
+}
+
+GameArena::~GameArena()
+{
+    Release();
+}
+
+void GameArena::Reset()
+{
+    m_currentBlock    = 0;
+    m_offset          = 0;
+    m_bytesAllocated  = 0;
+    m_allocationCount = 0;
+}
+
+void GameArena::Release()
+{
+    for (const Block& block : m_blocks)
+    {
+        ::operator delete(block.m_memory);
+    }
+    m_blocks.clear();
+    m_bytesReserved = 0;
+    Reset();
+}
+
+void* GameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    bytes = std::max<size_t>(bytes, 1);
+
+    // Try the current block, then any block kept from before the last Reset(), then grow
+    for (; m_currentBlock < m_blocks.size(); ++m_currentBlock, m_offset = 0)
+    {
+        const Block& block   = m_blocks[m_currentBlock];
+        uintptr_t    address = reinterpret_cast<uintptr_t>(block.m_memory) + m_offset;
+        size_t       padding = (alignment - address % alignment) % alignment;
+        if (m_offset + padding + bytes <= block.m_size)
+        {
+            m_offset += padding + bytes;
+            m_bytesAllocated += bytes;
+            ++m_allocationCount;
+            return reinterpret_cast<void*>(address + padding);
+        }
+    }
+
+    // Oversized requests get a block of their own, still kept across resets
+    MEMORY_TAG_SCOPE(MemoryTag::GameArena); // The tracker sees blocks, not what is carved out of them
+    Block block;
+    block.m_size   = std::max(m_blockSize, bytes + alignment);
+    block.m_memory = static_cast<std::byte*>(::operator new(block.m_size));
+    m_blocks.push_back(block);
+    m_bytesReserved += block.m_size;
+
+    m_currentBlock    = m_blocks.size() - 1;
+    uintptr_t address = reinterpret_cast<uintptr_t>(block.m_memory);
+    size_t    padding = (alignment - address % alignment) % alignment;
+    m_offset          = padding + bytes;
+    m_bytesAllocated += bytes;
+    ++m_allocationCount;
+    return reinterpret_cast<void*>(address + padding);
+}
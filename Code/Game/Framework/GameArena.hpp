@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// Monotonic bump allocator for everything that lives exactly as long as one Game. Allocation
+// advances an offset in the current block; deallocation is a no-op. Reset() rewinds to the first
+// block and keeps every block for the next game, so tearing a game down frees nothing one by one
+// and rebuilding it allocates nothing from the system once the blocks have grown to fit.
+//
+// It is a std::pmr::memory_resource, so std::pmr containers (EntityStore columns, broadphase cells)
+// draw from it directly. New<T>()/Delete() place whole objects in it; Delete() only runs the
+// destructor. A container that grows leaves its old buffer behind until Reset(), so reserve
+// large ones up front. Nothing allocated before a Reset() may be touched after it. Single-threaded.
+//
+class GameArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+    explicit GameArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~GameArena() override;
+    GameArena(const GameArena&)            = delete;
+    GameArena& operator=(const GameArena&) = delete;
+
+    template <typename T, typename... Args>
+    T* New(Args&&... args)
+    {
+        return new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void Delete(T* object)
+    {
+        if (object)
+        {
+            object->~T();
+        }
+    }
+
+    /// Forgets every allocation in one step, keeping the blocks for reuse
+    void Reset();
+    /// Returns every block to the system
+    void Release();
+
+    size_t GetBytesAllocated() const { return m_bytesAllocated; }
+    size_t GetBytesReserved() const { return m_bytesReserved; }
+    size_t GetAllocationCount() const { return m_allocationCount; }
+    size_t GetBlockCount() const { return m_blocks.size(); }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void*, size_t, size_t) override {}
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    struct Block
+    {
+        std::byte* m_memory = nullptr;
+        size_t     m_size   = 0;
+    };
+
+    size_t             m_blockSize;
+    std::vector<Block> m_blocks;
+    size_t             m_currentBlock    = 0;
+    size_t             m_offset          = 0; // Into m_blocks[m_currentBlock]
+    size_t             m_bytesAllocated  = 0;
+    size_t             m_bytesReserved   = 0;
+    size_t             m_allocationCount = 0;
+};
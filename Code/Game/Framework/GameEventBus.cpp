@@ -0,0 +1,196 @@
+#include "GameEventBus.hpp"
+
+#include <algorithm>
+
+GameEventBus::GameEventBus()
+{
+    m_drainedEvents.reserve(QUEUED_EVENT_CAPACITY);
+}
+
+void GameEventBus::Unsubscribe(EventSubscription& subscription)
+{
+    auto found = m_channels.find(subscription.m_eventId);
+    if (found != m_channels.end())
+    {
+        Channel& channel = found->second;
+        for (Subscriber& subscriber : channel.m_subscribers)
+        {
+            if (subscriber.m_id == subscription.m_subscriberId)
+            {
+                subscriber.m_thunk      = nullptr;
+                channel.m_hasTombstones = true;
+                break;
+            }
+        }
+        if (channel.m_dispatchDepth == 0)
+        {
+            Compact(channel);
+        }
+    }
+    subscription = EventSubscription();
+}
+
+void GameEventBus::UnsubscribeAll(const void* target)
+{
+    for (auto& [eventId, channel] : m_channels)
+    {
+        for (Subscriber& subscriber : channel.m_subscribers)
+        {
+            if (subscriber.m_target == target)
+            {
+                subscriber.m_thunk      = nullptr;
+                channel.m_hasTombstones = true;
+            }
+        }
+        if (channel.m_dispatchDepth == 0)
+        {
+            Compact(channel);
+        }
+    }
+}
+
+int GameEventBus::GetSubscriberCount(HashedName eventId) const
+{
+    auto found = m_channels.find(eventId.m_hash);
+    if (found == m_channels.end())
+    {
+        return 0;
+    }
+    const std::vector<Subscriber>& subscribers = found->second.m_subscribers;
+    return static_cast<int>(std::count_if(subscribers.begin(), subscribers.end(), [](const Subscriber& subscriber)
+    {
+        return subscriber.m_thunk != nullptr;
+    }));
+}
+
+void GameEventBus::Clear()
+{
+    m_channels.clear();
+}
+
+EventSubscription GameEventBus::AddSubscriber(uint64_t eventId, const Subscriber& subscriber)
+{
+    Subscriber entry = subscriber;
+    entry.m_id       = m_nextSubscriberId++;
+    m_channels[eventId].m_subscribers.push_back(entry);
+    return EventSubscription{eventId, entry.m_id};
+}
+
+int GameEventBus::Dispatch(uint64_t eventId, const void* payload)
+{
+    auto found = m_channels.find(eventId);
+    if (found == m_channels.end())
+    {
+        return 0;
+    }
+
+    Channel& channel = found->second;
+    ++channel.m_dispatchDepth;
+
+    // Index-based walk over the count at entry: callbacks may append (possibly reallocating) or
+    // tombstone entries without invalidating the iteration
+    int    delivered       = 0;
+    size_t subscriberCount = channel.m_subscribers.size();
+    for (size_t i = 0; i < subscriberCount; ++i)
+    {
+        Subscriber subscriber = channel.m_subscribers[i];
+        if (!subscriber.m_thunk)
+        {
+            continue;
+        }
+        ++delivered;
+        if (subscriber.m_thunk(subscriber.m_target, subscriber.m_function, payload))
+        {
+            break;
+        }
+    }
+
+    if (--channel.m_dispatchDepth == 0 && channel.m_hasTombstones)
+    {
+        Compact(channel);
+    }
+    return delivered;
+}
+
+int GameEventBus::DispatchQueuedEvents()
+{
+    m_drainedEvents.clear();
+    QueuedEvent queuedEvent;
+    while (m_drainedEvents.size() < QUEUED_EVENT_CAPACITY && m_queue.TryPop(queuedEvent))
+    {
+        queuedEvent.m_sequence = static_cast<uint32_t>(m_drainedEvents.size());
+        queuedEvent.m_consumed = false;
+        m_drainedEvents.push_back(queuedEvent);
+    }
+    if (m_drainedEvents.empty())
+    {
+        return 0;
+    }
+
+    // Group by event ID, keeping queue order inside each group
+    std::sort(m_drainedEvents.begin(), m_drainedEvents.end(), [](const QueuedEvent& a, const QueuedEvent& b)
+    {
+        return a.m_eventId != b.m_eventId ? a.m_eventId < b.m_eventId : a.m_sequence < b.m_sequence;
+    });
+
+    int          delivered  = 0;
+    QueuedEvent* groupFirst = m_drainedEvents.data();
+    QueuedEvent* end        = groupFirst + m_drainedEvents.size();
+    while (groupFirst != end)
+    {
+        QueuedEvent* groupLast = groupFirst;
+        while (groupLast != end && groupLast->m_eventId == groupFirst->m_eventId)
+        {
+            ++groupLast;
+        }
+        delivered += DispatchBatch(groupFirst->m_eventId, groupFirst, groupLast);
+        groupFirst = groupLast;
+    }
+    return delivered;
+}
+
+int GameEventBus::DispatchBatch(uint64_t eventId, QueuedEvent* first, QueuedEvent* last)
+{
+    auto found = m_channels.find(eventId);
+    if (found == m_channels.end())
+    {
+        return 0;
+    }
+
+    Channel& channel = found->second;
+    ++channel.m_dispatchDepth;
+
+    int    delivered       = 0;
+    size_t subscriberCount = channel.m_subscribers.size();
+    for (size_t i = 0; i < subscriberCount; ++i)
+    {
+        Subscriber subscriber = channel.m_subscribers[i];
+        for (QueuedEvent* event = first; event != last && subscriber.m_thunk; ++event)
+        {
+            if (event->m_consumed)
+            {
+                continue;
+            }
+            ++delivered;
+            event->m_consumed = subscriber.m_thunk(subscriber.m_target, subscriber.m_function, event->m_payload);
+            // The callback may have unsubscribed this very subscriber
+            subscriber.m_thunk = channel.m_subscribers[i].m_thunk;
+        }
+    }
+
+    if (--channel.m_dispatchDepth == 0 && channel.m_hasTombstones)
+    {
+        Compact(channel);
+    }
+    return delivered;
+}
+
+void GameEventBus::Compact(Channel& channel)
+{
+    std::vector<Subscriber>& subscribers = channel.m_subscribers;
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), [](const Subscriber& subscriber)
+    {
+        return subscriber.m_thunk == nullptr;
+    }), subscribers.end());
+    channel.m_hasTombstones = false;
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Framework/MpscRingQueue.hpp"
+#include "Game/Framework/StringHash.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Typed, allocation-free event dispatch. An event is any struct with a compile-time hashed ID:
+//
+//   struct EntityHitEvent
+//   {
+//       static constexpr HashedName ID = "Gameplay.EntityHit";
+//       Entity* m_target = nullptr;
+//       float   m_damage = 0.f;
+//   };
+//
+//   g_theEventBus->Subscribe<EntityHitEvent, &Game::OnEntityHit>(this);
+//   g_theEventBus->Fire(EntityHitEvent{target, 10.f});
+//
+// Payloads are passed by reference from the caller's stack, subscriber lists are flat vectors of
+// trivially copyable entries and lookups are one integer-keyed probe, so a Fire never touches the
+// heap. Subscribing or unsubscribing from inside a callback is safe: new subscribers are appended
+// and only see the next Fire, removed ones are tombstoned and compacted once dispatch unwinds.
+//
+// A callback returns true to consume the event and stop further delivery.
+//
+// Worker threads use QueueEvent instead of Fire: the payload is copied into a lock-free MPSC ring
+// and delivered on the main thread by DispatchQueuedEvents(), once per frame (App::BeginFrame).
+// The drained batch is sorted by event ID so each channel is looked up and its subscriber list
+// walked once per frame; every subscriber receives all of that frame's events of the type in
+// queue order before the next subscriber runs.
+//
+struct EventSubscription
+{
+    uint64_t m_eventId      = 0;
+    uint32_t m_subscriberId = 0;
+
+    bool IsValid() const { return m_subscriberId != 0; }
+};
+
+class GameEventBus
+{
+public:
+    static constexpr size_t QUEUED_PAYLOAD_CAPACITY = 64;
+    static constexpr size_t QUEUED_EVENT_CAPACITY   = 4096;
+
+    GameEventBus();
+
+    template <typename TEvent>
+    using EventCallback = bool (*)(const TEvent& event);
+
+    /// Free / static function subscriber
+    template <typename TEvent>
+    EventSubscription Subscribe(EventCallback<TEvent> callback);
+
+    /// Member function subscriber, the method is bound at compile time: Subscribe<EventT, &Class::Method>(object)
+    template <typename TEvent, auto Method, typename TObject>
+    EventSubscription Subscribe(TObject* object);
+
+    void Unsubscribe(EventSubscription& subscription);
+    void UnsubscribeAll(const void* target);
+
+    template <typename TEvent>
+    int Fire(const TEvent& event) { return Dispatch(TEvent::ID.m_hash, &event); }
+
+    /// Any thread. Returns false (and counts a drop) if this frame's queue is full.
+    template <typename TEvent>
+    bool QueueEvent(const TEvent& event);
+
+    /// Main thread, once per frame. Returns the number of callbacks invoked.
+    int      DispatchQueuedEvents();
+    uint32_t GetDroppedEventCount() const { return m_droppedEventCount.load(std::memory_order_relaxed); }
+
+    int  GetSubscriberCount(HashedName eventId) const;
+    void Clear();
+
+private:
+    using ErasedFunction = void (*)();
+    using Thunk          = bool (*)(const void* target, ErasedFunction function, const void* payload);
+
+    struct Subscriber
+    {
+        Thunk          m_thunk    = nullptr; // nullptr marks a tombstone
+        void*          m_target   = nullptr;
+        ErasedFunction m_function = nullptr;
+        uint32_t       m_id       = 0;
+    };
+
+    struct Channel
+    {
+        std::vector<Subscriber> m_subscribers;
+        int                     m_dispatchDepth = 0;
+        bool                    m_hasTombstones = false;
+    };
+
+    struct QueuedEvent
+    {
+        uint64_t m_eventId  = 0;
+        uint32_t m_sequence = 0;
+        bool     m_consumed = false;
+
+        alignas(16) unsigned char m_payload[QUEUED_PAYLOAD_CAPACITY];
+    };
+
+    EventSubscription AddSubscriber(uint64_t eventId, const Subscriber& subscriber);
+    int               Dispatch(uint64_t eventId, const void* payload);
+    int               DispatchBatch(uint64_t eventId, QueuedEvent* first, QueuedEvent* last);
+    static void       Compact(Channel& channel);
+
+    std::unordered_map<uint64_t, Channel, PrehashedKeyHasher> m_channels;
+    uint32_t                                                  m_nextSubscriberId = 1;
+
+    MpscRingQueue<QueuedEvent> m_queue{QUEUED_EVENT_CAPACITY};
+    std::vector<QueuedEvent>   m_drainedEvents; // main-thread staging, reserved once
+    std::atomic<uint32_t>      m_droppedEventCount{0};
+};
+
+template <typename TEvent>
+EventSubscription GameEventBus::Subscribe(EventCallback<TEvent> callback)
+{
+    Subscriber subscriber;
+    subscriber.m_function = reinterpret_cast<ErasedFunction>(callback);
+    subscriber.m_thunk    = [](const void*, ErasedFunction function, const void* payload) -> bool
+    {
+        return reinterpret_cast<EventCallback<TEvent>>(function)(*static_cast<const TEvent*>(payload));
+    };
+    return AddSubscriber(TEvent::ID.m_hash, subscriber);
+}
+
+template <typename TEvent, auto Method, typename TObject>
+EventSubscription GameEventBus::Subscribe(TObject* object)
+{
+    Subscriber subscriber;
+    subscriber.m_target = object;
+    subscriber.m_thunk  = [](const void* target, ErasedFunction, const void* payload) -> bool
+    {
+        return (static_cast<TObject*>(const_cast<void*>(target))->*Method)(*static_cast<const TEvent*>(payload));
+    };
+    return AddSubscriber(TEvent::ID.m_hash, subscriber);
+}
+
+template <typename TEvent>
+bool GameEventBus::QueueEvent(const TEvent& event)
+{
+    static_assert(std::is_trivially_copyable_v<TEvent>, "Queued event payloads are copied bitwise across threads");
+    static_assert(sizeof(TEvent) <= QUEUED_PAYLOAD_CAPACITY, "Queued event payload exceeds QUEUED_PAYLOAD_CAPACITY");
+    static_assert(alignof(TEvent) <= 16, "Queued event payload is over-aligned");
+
+    QueuedEvent queuedEvent;
+    queuedEvent.m_eventId = TEvent::ID.m_hash;
+    std::memcpy(queuedEvent.m_payload, &event, sizeof(TEvent));
+    if (!m_queue.TryPush(queuedEvent))
+    {
+        m_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
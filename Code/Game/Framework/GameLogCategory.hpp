@@ -0,0 +1,192 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// GameLogCategory.hpp
+//
+// Log categories that carry a compile-time minimum verbosity. A GAME_LOG call below either the
+// category's compile-time verbosity or the build-wide floor is discarded by `if constexpr`, so its
+// arguments are never evaluated and no code is emitted for it. Calls that survive compilation pay
+// a single relaxed atomic load against the category's runtime verbosity before formatting.
+//
+// Usage:
+//   Game.hpp: DECLARE_GAME_LOG_CATEGORY_EXTERN(LogGame, Info, Verbose)
+//   Game.cpp: DEFINE_GAME_LOG_CATEGORY(LogGame)
+//   Anywhere: GAME_LOG(LogGame, Debug, "Spawned %d props", count);
+//
+
+enum class LogVerbosity : uint8_t
+{
+    Verbose = 0,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Off
+};
+
+/// Build-wide floor, every category is clamped to at least this verbosity at compile time.
+/// Override from the project preprocessor definitions, e.g. GAME_LOG_COMPILE_TIME_FLOOR=Warning
+#ifndef GAME_LOG_COMPILE_TIME_FLOOR
+#if defined(_DEBUG)
+#define GAME_LOG_COMPILE_TIME_FLOOR Verbose
+#else
+#define GAME_LOG_COMPILE_TIME_FLOOR Info
+#endif
+#endif
+
+class GameLogCategoryBase;
+
+/// Optional second destination for surviving GAME_LOG calls (e.g. the in-game message log).
+class GameLogSink
+{
+public:
+    virtual ~GameLogSink() = default;
+    virtual void Receive(const GameLogCategoryBase& category, LogVerbosity verbosity, const char* message) = 0;
+    /// Messages logged straight to the engine logger; the category name is not kept past the call.
+    virtual void ReceiveExternal(const char* categoryName, LogVerbosity verbosity, const char* message) = 0;
+};
+
+class GameLogCategoryBase
+{
+public:
+    GameLogCategoryBase(const char* name, LogVerbosity defaultVerbosity)
+        : m_name(StripLogPrefix(name)), m_runtimeVerbosity(static_cast<uint8_t>(defaultVerbosity))
+    {
+        m_next = s_head;
+        s_head = this;
+    }
+
+    GameLogCategoryBase(const GameLogCategoryBase&)            = delete;
+    GameLogCategoryBase& operator=(const GameLogCategoryBase&) = delete;
+
+    const char* GetName() const { return m_name; }
+
+    bool IsEnabled(LogVerbosity verbosity) const
+    {
+        return static_cast<uint8_t>(verbosity) >= m_runtimeVerbosity.load(std::memory_order_relaxed);
+    }
+
+    LogVerbosity GetRuntimeVerbosity() const
+    {
+        return static_cast<LogVerbosity>(m_runtimeVerbosity.load(std::memory_order_relaxed));
+    }
+
+    void SetRuntimeVerbosity(LogVerbosity verbosity)
+    {
+        m_runtimeVerbosity.store(static_cast<uint8_t>(verbosity), std::memory_order_relaxed);
+    }
+
+    /// Cold path for console commands and config, walks every category defined in the program.
+    static GameLogCategoryBase* FindByName(const char* name)
+    {
+        for (GameLogCategoryBase* category = s_head; category; category = category->m_next)
+        {
+            if (std::strcmp(category->m_name, name) == 0)
+            {
+                return category;
+            }
+        }
+        return nullptr;
+    }
+
+    static void SetAllRuntimeVerbosity(LogVerbosity verbosity)
+    {
+        for (GameLogCategoryBase* category = s_head; category; category = category->m_next)
+        {
+            category->SetRuntimeVerbosity(verbosity);
+        }
+    }
+
+    static GameLogSink* GetSink() { return s_sink.load(std::memory_order_acquire); }
+    static void         SetSink(GameLogSink* sink) { s_sink.store(sink, std::memory_order_release); }
+
+private:
+    static const char* StripLogPrefix(const char* name)
+    {
+        return std::strncmp(name, "Log", 3) == 0 && name[3] != '\0' ? name + 3 : name;
+    }
+
+    const char*                        m_name = nullptr;
+    std::atomic<uint8_t>               m_runtimeVerbosity;
+    GameLogCategoryBase*               m_next = nullptr;
+    static inline GameLogCategoryBase* s_head = nullptr;
+    static inline std::atomic<GameLogSink*> s_sink{nullptr};
+};
+
+template <LogVerbosity CompileTimeVerbosity>
+class GameLogCategory : public GameLogCategoryBase
+{
+public:
+    static constexpr LogVerbosity COMPILE_TIME_VERBOSITY =
+        CompileTimeVerbosity > LogVerbosity::GAME_LOG_COMPILE_TIME_FLOOR ? CompileTimeVerbosity : LogVerbosity::GAME_LOG_COMPILE_TIME_FLOOR;
+
+    using GameLogCategoryBase::GameLogCategoryBase;
+};
+
+/// Route a surviving call to the engine logger, Verbose shares the engine's DEBUG level.
+template <LogVerbosity Verbosity, typename... Args>
+void DispatchGameLog(const GameLogCategoryBase& category, const char* format, const Args&... args)
+{
+    using namespace enigma::core;
+    const char* categoryName = category.GetName();
+    if constexpr (Verbosity <= LogVerbosity::Debug)
+    {
+        LogDebug(categoryName, format, args...);
+    }
+    else if constexpr (Verbosity == LogVerbosity::Info)
+    {
+        LogInfo(categoryName, format, args...);
+    }
+    else if constexpr (Verbosity == LogVerbosity::Warning)
+    {
+        LogWarn(categoryName, format, args...);
+    }
+    else if constexpr (Verbosity == LogVerbosity::Error)
+    {
+        LogError(categoryName, format, args...);
+    }
+
+    if (GameLogSink* sink = GameLogCategoryBase::GetSink())
+    {
+        if constexpr (sizeof...(Args) == 0)
+        {
+            sink->Receive(category, Verbosity, format);
+        }
+        else
+        {
+            char message[512];
+            std::snprintf(message, sizeof(message), format, args...);
+            sink->Receive(category, Verbosity, message);
+        }
+    }
+}
+
+#define DECLARE_GAME_LOG_CATEGORY_EXTERN(CategoryName, DefaultVerbosity, CompileTimeVerbosity) \
+    extern struct FGameLogCategory##CategoryName : public GameLogCategory<LogVerbosity::CompileTimeVerbosity> \
+    { \
+        FGameLogCategory##CategoryName() : GameLogCategory(#CategoryName, LogVerbosity::DefaultVerbosity) {} \
+    } CategoryName;
+
+#define DEFINE_GAME_LOG_CATEGORY(CategoryName) \
+    FGameLogCategory##CategoryName CategoryName;
+
+#define GAME_LOG(CategoryName, Verbosity, ...) \
+    do \
+    { \
+        if constexpr (LogVerbosity::Verbosity != LogVerbosity::Off && \
+                      LogVerbosity::Verbosity >= std::decay_t<decltype(CategoryName)>::COMPILE_TIME_VERBOSITY) \
+        { \
+            if (CategoryName.IsEnabled(LogVerbosity::Verbosity)) \
+            { \
+                DispatchGameLog<LogVerbosity::Verbosity>(CategoryName, __VA_ARGS__); \
+            } \
+        } \
+    } \
+    while (0)
@@ -0,0 +1,285 @@
+#include "JobSystem.hpp"
+
+#include <string>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+namespace
+{
+    struct CurrentThread
+    {
+        const JobSystem* m_system = nullptr;
+        int              m_index  = 0;
+    };
+
+    thread_local CurrentThread t_currentThread;
+
+    constexpr int64_t DEQUE_MASK = static_cast<int64_t>(JobSystem::DEQUE_CAPACITY - 1);
+    static_assert((JobSystem::DEQUE_CAPACITY & (JobSystem::DEQUE_CAPACITY - 1)) == 0, "Deque capacity must be a power of two");
+}
+
+JobSystem::WorkStealingDeque::WorkStealingDeque()
+    : m_slots(std::make_unique<std::atomic<Job*>[]>(DEQUE_CAPACITY))
+{
+}
+
+bool JobSystem::WorkStealingDeque::Push(Job* job)
+{
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top    = m_top.load(std::memory_order_acquire);
+    if (bottom - top >= static_cast<int64_t>(DEQUE_CAPACITY))
+    {
+        return false;
+    }
+    m_slots[bottom & DEQUE_MASK].store(job, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+Job* JobSystem::WorkStealingDeque::Pop()
+{
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed); // Empty
+        return nullptr;
+    }
+
+    Job* job = m_slots[bottom & DEQUE_MASK].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // Last job: race any thief for it on top
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* JobSystem::WorkStealingDeque::Steal()
+{
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    Job* job = m_slots[top & DEQUE_MASK].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr; // Lost to the owner or another thief
+    }
+    return job;
+}
+
+JobSystem::JobSystem(int threadCount)
+    : m_creatingThread(std::this_thread::get_id())
+    , m_previousSystem(t_currentThread.m_system)
+    , m_previousIndex(t_currentThread.m_index)
+{
+    if (threadCount <= 0)
+    {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    m_threads.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i)
+    {
+        std::unique_ptr<ThreadState> thread = std::make_unique<ThreadState>();
+        thread->m_jobRing                   = std::make_unique<RingSlot[]>(DEQUE_CAPACITY);
+        thread->m_stealSeed                 = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        m_threads.push_back(std::move(thread));
+    }
+
+    t_currentThread.m_system = this;
+    t_currentThread.m_index  = 0;
+    for (int i = 1; i < threadCount; ++i)
+    {
+        m_threads[i]->m_thread = std::thread(&JobSystem::WorkerMain, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_isQuitting.store(true);
+    }
+    m_wakeCondition.notify_all();
+    for (std::unique_ptr<ThreadState>& thread : m_threads)
+    {
+        if (thread->m_thread.joinable())
+        {
+            thread->m_thread.join();
+        }
+    }
+    if (t_currentThread.m_system == this)
+    {
+        t_currentThread.m_system = m_previousSystem;
+        t_currentThread.m_index  = m_previousIndex;
+    }
+}
+
+void JobSystem::Run(const Job& job)
+{
+    ThreadState& thread = *m_threads[GetSubmittingThreadIndex()];
+    RingSlot&    slot   = thread.m_jobRing[thread.m_jobRingNext++ & (DEQUE_CAPACITY - 1)];
+    if (slot.m_isInUse.load(std::memory_order_acquire))
+    {
+        // The slot's last job is still queued or not yet copied out by a thief, keep it intact
+        job.m_function(job.m_data, job.m_begin, job.m_end);
+        return;
+    }
+    slot.m_job             = job;
+    slot.m_job.m_slotInUse = &slot.m_isInUse;
+    slot.m_isInUse.store(true, std::memory_order_relaxed); // Published with the deque push
+    if (job.m_counter)
+    {
+        job.m_counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    Submit(thread, &slot.m_job);
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    int threadIndex = GetSubmittingThreadIndex();
+    while (!counter.IsDone())
+    {
+        if (!TryRunOne(threadIndex))
+        {
+            // The remaining jobs are running elsewhere
+            std::this_thread::yield();
+        }
+    }
+}
+
+int JobSystem::GetCurrentThreadIndex() const
+{
+    if (t_currentThread.m_system == this)
+    {
+        return t_currentThread.m_index;
+    }
+    // The creating thread's slot may belong to a system created after this one
+    return std::this_thread::get_id() == m_creatingThread ? 0 : -1;
+}
+
+int JobSystem::GetSubmittingThreadIndex() const
+{
+    int threadIndex = GetCurrentThreadIndex();
+    ASSERT_OR_DIE(threadIndex >= 0, "JobSystem: only the creating thread and the workers may submit or wait");
+    return threadIndex;
+}
+
+void JobSystem::WorkerMain(int threadIndex)
+{
+    t_currentThread.m_system = this;
+    t_currentThread.m_index  = threadIndex;
+    MemoryTracker::SetThreadTag(MemoryTag::Jobs);
+    Profiler::SetThreadName(("Job " + std::to_string(threadIndex)).c_str());
+
+    while (!m_isQuitting.load(std::memory_order_acquire))
+    {
+        if (TryRunOne(threadIndex))
+        {
+            continue;
+        }
+
+        // Either a submitter sees this thread counted as sleeping and notifies, or this thread
+        // sees the submitter's queued job in the predicate; both sides use seq_cst
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingWorkers.fetch_add(1);
+        m_wakeCondition.wait(lock, [this]()
+        {
+            return m_queuedJobs.load() > 0 || m_isQuitting.load();
+        });
+        m_sleepingWorkers.fetch_sub(1);
+    }
+}
+
+void JobSystem::Submit(ThreadState& thread, Job* job)
+{
+    if (!thread.m_deque.Push(job))
+    {
+        TakeAndExecute(job); // Deque full, run it now rather than drop it
+        return;
+    }
+    m_queuedJobs.fetch_add(1);
+    if (m_sleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wakeCondition.notify_one();
+    }
+}
+
+bool JobSystem::TryRunOne(int threadIndex)
+{
+    Job* job = FindJob(threadIndex);
+    if (!job)
+    {
+        return false;
+    }
+    m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    TakeAndExecute(job);
+    return true;
+}
+
+Job* JobSystem::FindJob(int threadIndex)
+{
+    ThreadState& self = *m_threads[threadIndex];
+    if (Job* job = self.m_deque.Pop())
+    {
+        return job;
+    }
+
+    // Start stealing at a random victim so thieves spread across the deques
+    uint32_t threadCount = static_cast<uint32_t>(m_threads.size());
+    self.m_stealSeed ^= self.m_stealSeed << 13;
+    self.m_stealSeed ^= self.m_stealSeed >> 17;
+    self.m_stealSeed ^= self.m_stealSeed << 5;
+    uint32_t firstVictim = self.m_stealSeed % threadCount;
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        uint32_t victim = (firstVictim + i) % threadCount;
+        if (victim == static_cast<uint32_t>(threadIndex))
+        {
+            continue;
+        }
+        if (Job* job = m_threads[victim]->m_deque.Steal())
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::TakeAndExecute(Job* job)
+{
+    // Copy a Run() job out before freeing its ring slot for the submitter to reuse
+    Job taken = *job;
+    if (taken.m_slotInUse)
+    {
+        taken.m_slotInUse->store(false, std::memory_order_release);
+    }
+    Execute(taken);
+}
+
+void JobSystem::Execute(Job& job)
+{
+    // Read the counter first: once it drops, the submitter may free the job
+    JobCounter* counter = job.m_counter;
+    job.m_function(job.m_data, job.m_begin, job.m_end);
+    if (counter)
+    {
+        counter->m_pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
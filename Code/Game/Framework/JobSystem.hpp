@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Counts unfinished jobs. Each job submitted with a counter increments it and decrements it when
+/// done; JobSystem::Wait() on the counter returns once it reaches zero.
+struct JobCounter
+{
+    std::atomic<int> m_pending{0};
+
+    bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+};
+
+/// A unit of work: m_function(m_data, m_begin, m_end). Plain data so the deques can hand it out
+/// by pointer without locks.
+struct Job
+{
+    using Function = void (*)(void* data, size_t begin, size_t end);
+
+    Function           m_function  = nullptr;
+    void*              m_data      = nullptr;
+    size_t             m_begin     = 0;
+    size_t             m_end       = 0;
+    JobCounter*        m_counter   = nullptr;
+    std::atomic<bool>* m_slotInUse = nullptr; // Set by JobSystem on Run()'s stored copy, leave null
+};
+
+//-----------------------------------------------------------------------------------------------
+// Fixed pool of worker threads with one work-stealing deque per thread (Chase-Lev). A thread
+// pushes and pops jobs at the bottom of its own deque, LIFO, so freshly split work stays in its
+// cache; idle threads steal from the top of a random victim's deque. Workers sleep on a condition
+// variable only when every deque is empty.
+//
+// The thread that created the system takes part as thread 0: it submits, and Wait() runs queued
+// jobs instead of blocking until its counter drains. Jobs can submit and wait on further jobs, which
+// is how dependencies are expressed - a job that needs others' results Wait()s on their counter.
+// Only the creating thread and the workers may submit or wait; any other thread asserts. Systems can
+// nest on one thread (a local system while g_theJobSystem is alive): each remembers the thread it
+// was created on, and destroying the inner one restores the outer one's slot.
+//
+class JobSystem
+{
+public:
+    static constexpr size_t DEQUE_CAPACITY = 4096; // Per thread, a full deque runs the job inline
+
+    /// threadCount counts the calling thread; 0 picks one per hardware thread
+    explicit JobSystem(int threadCount = 0);
+    ~JobSystem();
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// Queues one job. The job is copied into the next slot of the submitting thread's ring; when
+    /// that slot's previous job has not been taken yet (or the deque is full) it runs inline here.
+    void Run(const Job& job);
+    /// Runs queued jobs on this thread until counter reaches zero
+    void Wait(const JobCounter& counter);
+
+    /// Calls function(begin, end) over disjoint subranges of [begin, end) of at least grainSize
+    /// elements, spread across all threads, and returns when every subrange is done.
+    template <typename Function>
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, const Function& function);
+
+    int GetThreadCount() const { return static_cast<int>(m_threads.size()); }
+    /// Index of the calling thread in this system: 0 for the creating thread, -1 for an outsider
+    int GetCurrentThreadIndex() const;
+
+private:
+    class WorkStealingDeque
+    {
+    public:
+        WorkStealingDeque();
+
+        bool Push(Job* job); // Owner only, false when full
+        Job* Pop();          // Owner only
+        Job* Steal();        // Any thread
+
+    private:
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        std::unique_ptr<std::atomic<Job*>[]> m_slots;
+    };
+
+    /// Storage for one Run() submission, busy from the copy in until a thread takes the job out
+    struct RingSlot
+    {
+        Job               m_job;
+        std::atomic<bool> m_isInUse{false};
+    };
+
+    struct ThreadState
+    {
+        WorkStealingDeque           m_deque;
+        std::unique_ptr<RingSlot[]> m_jobRing; // Storage for Run() submissions from this thread
+        size_t                      m_jobRingNext = 0;
+        uint32_t                    m_stealSeed   = 0;
+        std::thread                 m_thread;  // Empty for thread 0
+    };
+
+    void WorkerMain(int threadIndex);
+    int  GetSubmittingThreadIndex() const; // Asserts the caller belongs to this system
+    void Submit(ThreadState& thread, Job* job);
+    bool TryRunOne(int threadIndex);
+    Job* FindJob(int threadIndex);
+    void TakeAndExecute(Job* job);
+    void Execute(Job& job);
+
+    std::vector<std::unique_ptr<ThreadState>> m_threads;
+    std::thread::id                           m_creatingThread;
+
+    // The creating thread's slot before this system took it, put back on destruction
+    const JobSystem* m_previousSystem = nullptr;
+    int              m_previousIndex  = 0;
+
+    std::atomic<int>        m_queuedJobs{0};
+    std::atomic<int>        m_sleepingWorkers{0};
+    std::atomic<bool>       m_isQuitting{false};
+    std::mutex              m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+};
+
+template <typename Function>
+void JobSystem::ParallelFor(size_t begin, size_t end, size_t grainSize, const Function& function)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    size_t count = end - begin;
+    grainSize    = std::max<size_t>(grainSize, 1);
+    if (m_threads.size() == 1 || count <= grainSize)
+    {
+        function(begin, end);
+        return;
+    }
+
+    // A few chunks per thread so stealing can even out uneven ranges, never below the grain
+    size_t chunkSize  = std::max(grainSize, (count + m_threads.size() * 4 - 1) / (m_threads.size() * 4));
+    size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    JobCounter       counter;
+    std::vector<Job> chunks(chunkCount - 1);
+    auto             trampoline = [](void* data, size_t chunkBegin, size_t chunkEnd)
+    {
+        (*static_cast<const Function*>(data))(chunkBegin, chunkEnd);
+    };
+
+    counter.m_pending.store(static_cast<int>(chunks.size()), std::memory_order_relaxed);
+    ThreadState& thread = *m_threads[GetSubmittingThreadIndex()];
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        Job& chunk       = chunks[i];
+        chunk.m_function = trampoline;
+        chunk.m_data     = const_cast<Function*>(&function);
+        chunk.m_begin    = begin + (i + 1) * chunkSize;
+        chunk.m_end      = std::min(end, chunk.m_begin + chunkSize);
+        chunk.m_counter  = &counter;
+        Submit(thread, &chunk);
+    }
+
+    // The first chunk runs here while the others are stolen
+    function(begin, std::min(end, begin + chunkSize));
+    Wait(counter);
+}
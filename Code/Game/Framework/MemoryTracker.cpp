@@ -0,0 +1,336 @@
+#include "MemoryTracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+
+namespace
+{
+    constexpr int TAG_COUNT = static_cast<int>(MemoryTag::COUNT);
+
+    constexpr const char* TAG_NAMES[TAG_COUNT] = {
+        "Untagged", "Engine", "Resource", "Registry", "Audio", "ImGui", "DebugRender",
+        "Render", "Game", "GameArena", "Jobs", "Profiler", "Tests",
+    };
+
+    /// Written in front of every block operator new hands out
+    struct AllocationHeader
+    {
+        void*     m_block = nullptr; // What malloc returned
+        size_t    m_size  = 0;       // What the caller asked for
+        MemoryTag m_tag   = MemoryTag::Untagged;
+    };
+
+    /// Updated by every thread; a cache line each so tags in use on different threads do not contend
+    struct alignas(64) TagCounters
+    {
+        std::atomic<int64_t>  m_liveBytes{0};
+        std::atomic<int64_t>  m_peakBytes{0};
+        std::atomic<int64_t>  m_liveAllocations{0};
+        std::atomic<uint64_t> m_totalAllocations{0};
+        std::atomic<uint64_t> m_totalBytes{0};
+    };
+
+    /// Read and written by EndFrame() on the main thread only
+    struct FrameCounters
+    {
+        uint64_t m_startAllocations     = 0;
+        uint64_t m_startBytes           = 0;
+        uint64_t m_lastFrameAllocations = 0;
+        uint64_t m_lastFrameBytes       = 0;
+    };
+
+    // Constant-initialized, so they count correctly from the first allocation of static init on
+    TagCounters            s_tags[TAG_COUNT];
+    std::atomic<int64_t>   s_totalLiveBytes{0};
+    std::atomic<int64_t>   s_totalPeakBytes{0};
+    thread_local MemoryTag t_threadTag = MemoryTag::Untagged;
+
+    FrameCounters s_frames[TAG_COUNT];
+    float         s_frameHistory[MemoryTracker::HISTORY_FRAME_COUNT] = {};
+    int           s_frameHistoryCount                                = 0;
+    int           s_frameHistoryNext                                 = 0;
+    uint64_t      s_frameCount                                       = 0;
+    uint64_t      s_allocationFreeFrameCount                         = 0;
+
+    void RaisePeak(std::atomic<int64_t>& peak, int64_t value)
+    {
+        int64_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+    int index = static_cast<int>(tag);
+    return index >= 0 && index < TAG_COUNT ? TAG_NAMES[index] : "Unknown";
+}
+
+MemoryTag MemoryTracker::GetThreadTag()
+{
+    return t_threadTag;
+}
+
+void MemoryTracker::SetThreadTag(MemoryTag tag)
+{
+    t_threadTag = tag;
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment)
+{
+    alignment = std::max(alignment, alignof(AllocationHeader));
+    if (size > SIZE_MAX - sizeof(AllocationHeader) - alignment)
+    {
+        return nullptr;
+    }
+    void* block = std::malloc(size + sizeof(AllocationHeader) + alignment);
+    if (!block)
+    {
+        return nullptr;
+    }
+
+    // The first aligned address with room for the header in front of it
+    uintptr_t         memory = (reinterpret_cast<uintptr_t>(block) + sizeof(AllocationHeader) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(memory) - 1;
+    header->m_block          = block;
+    header->m_size           = size;
+    header->m_tag            = t_threadTag;
+
+    TagCounters& counters = s_tags[static_cast<int>(header->m_tag)];
+    int64_t      bytes    = static_cast<int64_t>(size);
+    RaisePeak(counters.m_peakBytes, counters.m_liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    RaisePeak(s_totalPeakBytes, s_totalLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    counters.m_liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.m_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.m_totalBytes.fetch_add(size, std::memory_order_relaxed);
+    return reinterpret_cast<void*>(memory);
+}
+
+void MemoryTracker::Free(void* memory) noexcept
+{
+    if (!memory)
+    {
+        return;
+    }
+    AllocationHeader* header   = static_cast<AllocationHeader*>(memory) - 1;
+    TagCounters&      counters = s_tags[static_cast<int>(header->m_tag)];
+    int64_t           bytes    = static_cast<int64_t>(header->m_size);
+    counters.m_liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    counters.m_liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    s_totalLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    std::free(header->m_block);
+}
+
+void MemoryTracker::EndFrame()
+{
+    uint64_t frameAllocations = 0;
+    for (int tag = 0; tag < TAG_COUNT; ++tag)
+    {
+        FrameCounters& frame            = s_frames[tag];
+        uint64_t       totalAllocations = s_tags[tag].m_totalAllocations.load(std::memory_order_relaxed);
+        uint64_t       totalBytes       = s_tags[tag].m_totalBytes.load(std::memory_order_relaxed);
+        frame.m_lastFrameAllocations    = totalAllocations - frame.m_startAllocations;
+        frame.m_lastFrameBytes          = totalBytes - frame.m_startBytes;
+        frame.m_startAllocations        = totalAllocations;
+        frame.m_startBytes              = totalBytes;
+        frameAllocations += frame.m_lastFrameAllocations;
+    }
+
+    s_frameHistory[s_frameHistoryNext] = static_cast<float>(frameAllocations);
+    s_frameHistoryNext                 = (s_frameHistoryNext + 1) % HISTORY_FRAME_COUNT;
+    s_frameHistoryCount                = std::min(s_frameHistoryCount + 1, HISTORY_FRAME_COUNT);
+    s_allocationFreeFrameCount         = frameAllocations == 0 ? s_allocationFreeFrameCount + 1 : 0;
+    ++s_frameCount;
+}
+
+uint64_t MemoryTracker::GetFrameCount()
+{
+    return s_frameCount;
+}
+
+MemoryTracker::TagStats MemoryTracker::GetTagStats(MemoryTag tag)
+{
+    const TagCounters&   counters = s_tags[static_cast<int>(tag)];
+    const FrameCounters& frame    = s_frames[static_cast<int>(tag)];
+
+    TagStats stats;
+    stats.m_liveBytes            = counters.m_liveBytes.load(std::memory_order_relaxed);
+    stats.m_peakBytes            = counters.m_peakBytes.load(std::memory_order_relaxed);
+    stats.m_liveAllocations      = counters.m_liveAllocations.load(std::memory_order_relaxed);
+    stats.m_totalAllocations     = counters.m_totalAllocations.load(std::memory_order_relaxed);
+    stats.m_totalBytes           = counters.m_totalBytes.load(std::memory_order_relaxed);
+    stats.m_lastFrameAllocations = frame.m_lastFrameAllocations;
+    stats.m_lastFrameBytes       = frame.m_lastFrameBytes;
+    return stats;
+}
+
+MemoryTracker::TagStats MemoryTracker::GetTotalStats()
+{
+    TagStats total;
+    for (int tag = 0; tag < TAG_COUNT; ++tag)
+    {
+        TagStats stats = GetTagStats(static_cast<MemoryTag>(tag));
+        total.m_liveBytes += stats.m_liveBytes;
+        total.m_liveAllocations += stats.m_liveAllocations;
+        total.m_totalAllocations += stats.m_totalAllocations;
+        total.m_totalBytes += stats.m_totalBytes;
+        total.m_lastFrameAllocations += stats.m_lastFrameAllocations;
+        total.m_lastFrameBytes += stats.m_lastFrameBytes;
+    }
+    total.m_peakBytes = s_totalPeakBytes.load(std::memory_order_relaxed);
+    return total;
+}
+
+int MemoryTracker::GetFrameAllocationHistory(float* outCounts, int maxCount)
+{
+    int count = std::min(s_frameHistoryCount, maxCount);
+    int first = s_frameHistoryNext - count + HISTORY_FRAME_COUNT;
+    for (int i = 0; i < count; ++i)
+    {
+        outCounts[i] = s_frameHistory[(first + i) % HISTORY_FRAME_COUNT];
+    }
+    return count;
+}
+
+uint64_t MemoryTracker::GetAllocationFreeFrameCount()
+{
+    return s_allocationFreeFrameCount;
+}
+
+void MemoryTracker::ResetPeak(MemoryTag tag)
+{
+    TagCounters& counters = s_tags[static_cast<int>(tag)];
+    counters.m_peakBytes.store(counters.m_liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void MemoryTracker::ResetPeaks()
+{
+    for (int tag = 0; tag < TAG_COUNT; ++tag)
+    {
+        ResetPeak(static_cast<MemoryTag>(tag));
+    }
+    s_totalPeakBytes.store(s_totalLiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+bool MemoryTracker::ExportJson(const std::string& path)
+{
+    std::filesystem::path filePath(path);
+    std::error_code       error;
+    if (filePath.has_parent_path())
+    {
+        std::filesystem::create_directories(filePath.parent_path(), error);
+    }
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+
+    auto writeStats = [file](const char* name, const TagStats& stats)
+    {
+        std::fprintf(file, "{\"name\":\"%s\",\"liveBytes\":%lld,\"peakBytes\":%lld,\"liveAllocations\":%lld,"
+                     "\"totalAllocations\":%llu,\"totalBytes\":%llu,\"lastFrameAllocations\":%llu,\"lastFrameBytes\":%llu}",
+                     name, static_cast<long long>(stats.m_liveBytes), static_cast<long long>(stats.m_peakBytes),
+                     static_cast<long long>(stats.m_liveAllocations), static_cast<unsigned long long>(stats.m_totalAllocations),
+                     static_cast<unsigned long long>(stats.m_totalBytes), static_cast<unsigned long long>(stats.m_lastFrameAllocations),
+                     static_cast<unsigned long long>(stats.m_lastFrameBytes));
+    };
+
+    std::fprintf(file, "{\"trackingEnabled\":%s,\"frame\":%llu,\"allocationFreeFrames\":%llu,\n\"total\":",
+                 GAME_MEMORY_TRACKING_ENABLED ? "true" : "false", static_cast<unsigned long long>(s_frameCount),
+                 static_cast<unsigned long long>(s_allocationFreeFrameCount));
+    writeStats("Total", GetTotalStats());
+    std::fputs(",\n\"tags\":[\n", file);
+    for (int tag = 0; tag < TAG_COUNT; ++tag)
+    {
+        writeStats(TAG_NAMES[tag], GetTagStats(static_cast<MemoryTag>(tag)));
+        std::fputs(tag + 1 < TAG_COUNT ? ",\n" : "\n", file);
+    }
+    std::fputs("]}\n", file);
+    return std::fclose(file) == 0;
+}
+
+#if GAME_MEMORY_TRACKING_ENABLED
+//-----------------------------------------------------------------------------------------------
+// Global operator new/delete replacements. Every form routes through MemoryTracker, including the
+// sized and nothrow deletes, since a block may be freed through any of them.
+//
+namespace
+{
+    void* AllocateOrThrow(size_t size, size_t alignment)
+    {
+        for (;;)
+        {
+            if (void* memory = MemoryTracker::Allocate(size, alignment))
+            {
+                return memory;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t size)
+{
+    return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size)
+{
+    return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return AllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return AllocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, size_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, size_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { MemoryTracker::Free(memory); }
+#endif
@@ -0,0 +1,130 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//-----------------------------------------------------------------------------------------------
+// MemoryTracker.hpp
+//
+// Tagged heap accounting. The game replaces the global operator new/delete, so every C++ heap
+// allocation in the executable (the engine libraries included) is counted against the tag that is
+// current on the allocating thread: live bytes and allocations, the high-water mark, the running
+// total and how many the last frame made. MEMORY_TAG_SCOPE(MemoryTag::X) sets the tag for the
+// enclosing block; the engine's subsystems are tagged from the App call sites that drive them.
+// Frees are charged back to the tag the block was allocated under, whichever thread frees it.
+//
+// Each block carries a small header in front of it recording its size and tag. Allocations that go
+// around operator new (malloc, the graphics driver, GPU memory) are not seen.
+//
+// The goal is a steady-state frame that allocates nothing: EndFrame() closes each frame's counts
+// and GetAllocationFreeFrameCount() is how many frames in a row have managed it.
+//
+// Usage:
+//   Anywhere:  MEMORY_TAG_SCOPE(MemoryTag::Resource);
+//   Threads:   MemoryTracker::SetThreadTag(MemoryTag::Jobs); for everything the thread does
+//   App.cpp:   MemoryTracker::EndFrame(); once per frame
+//
+
+/// Build-wide switch. With GAME_MEMORY_TRACKING_ENABLED=0 operator new is not replaced and every
+/// count stays zero. Game.vcxproj sets it to 1 for Debug and 0 for Release; define it to 1 in a
+/// Release build to profile memory there. Builds that set neither follow _DEBUG.
+#ifndef GAME_MEMORY_TRACKING_ENABLED
+#ifdef _DEBUG
+#define GAME_MEMORY_TRACKING_ENABLED 1
+#else
+#define GAME_MEMORY_TRACKING_ENABLED 0
+#endif
+#endif
+
+enum class MemoryTag : uint8_t
+{
+    Untagged,
+    Engine,      // Engine startup and update not attributed to a subsystem below
+    Resource,    // ResourceSubsystem
+    Registry,    // RegisterSubsystem
+    Audio,       // AudioSubsystem
+    ImGui,       // ImGuiSubsystem and the panels it draws
+    DebugRender, // DebugRenderSystem
+    Render,      // Renderer, RenderDevice and render thread
+    Game,        // Game, props and entities outside the arena
+    GameArena,   // Blocks the game arena reserves, whatever it hands out of them
+    Jobs,        // Job system worker threads
+    Profiler,
+    Tests,       // Startup tests and benchmarks
+    COUNT
+};
+
+class MemoryTracker
+{
+public:
+    static constexpr int HISTORY_FRAME_COUNT = 240;
+
+    struct TagStats
+    {
+        int64_t  m_liveBytes            = 0;
+        int64_t  m_peakBytes            = 0;
+        int64_t  m_liveAllocations      = 0;
+        uint64_t m_totalAllocations     = 0;
+        uint64_t m_totalBytes           = 0;
+        uint64_t m_lastFrameAllocations = 0;
+        uint64_t m_lastFrameBytes       = 0;
+    };
+
+    static const char* GetTagName(MemoryTag tag);
+
+    /// The tag new allocations on this thread are charged to
+    static MemoryTag GetThreadTag();
+    static void      SetThreadTag(MemoryTag tag);
+
+    /// Main thread, once per frame: closes the frame's allocation counts
+    static void     EndFrame();
+    static uint64_t GetFrameCount();
+
+    static TagStats GetTagStats(MemoryTag tag);
+    /// Summed over every tag; the peak is the high-water mark of the sum, not a sum of peaks
+    static TagStats GetTotalStats();
+    /// Allocations per frame for the last HISTORY_FRAME_COUNT frames, oldest first
+    static int      GetFrameAllocationHistory(float* outCounts, int maxCount);
+    /// Frames in a row, up to the last one, that allocated nothing
+    static uint64_t GetAllocationFreeFrameCount();
+
+    /// Restarts a high-water mark from the tag's current live bytes
+    static void ResetPeak(MemoryTag tag);
+    /// Restarts every tag's high-water mark and the total's
+    static void ResetPeaks();
+
+    /// Writes every tag's stats as JSON, creating missing directories
+    static bool ExportJson(const std::string& path);
+
+    // Used by the replaced operator new/delete
+    static void* Allocate(size_t size, size_t alignment);
+    static void  Free(void* memory) noexcept;
+};
+
+/// Charges allocations on this thread to a tag for its lifetime. Use through MEMORY_TAG_SCOPE.
+class MemoryTagScope
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag)
+        : m_previousTag(MemoryTracker::GetThreadTag())
+    {
+        MemoryTracker::SetThreadTag(tag);
+    }
+
+    ~MemoryTagScope() { MemoryTracker::SetThreadTag(m_previousTag); }
+
+    MemoryTagScope(const MemoryTagScope&)            = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_previousTag;
+};
+
+#define MEMORY_TAG_CONCATENATE_INNER(a, b) a##b
+#define MEMORY_TAG_CONCATENATE(a, b)       MEMORY_TAG_CONCATENATE_INNER(a, b)
+
+#if GAME_MEMORY_TRACKING_ENABLED
+#define MEMORY_TAG_SCOPE(Tag) MemoryTagScope MEMORY_TAG_CONCATENATE(memoryTagScope_, __LINE__)(Tag)
+#else
+#define MEMORY_TAG_SCOPE(Tag) ((void)0)
+#endif
@@ -0,0 +1,121 @@
+#include "MemoryWindow.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Framework/GameArena.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+#include "ThirdParty/imgui/imgui.h"
+
+namespace
+{
+    constexpr const char* DUMP_DIRECTORY = ".enigma/profile/";
+
+    double ToKilobytes(int64_t bytes)
+    {
+        return static_cast<double>(bytes) / 1024.0;
+    }
+
+    void RenderRow(const char* name, const MemoryTracker::TagStats& stats)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", ToKilobytes(stats.m_liveBytes));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", ToKilobytes(stats.m_peakBytes));
+        ImGui::TableNextColumn();
+        ImGui::Text("%lld", static_cast<long long>(stats.m_liveAllocations));
+        ImGui::TableNextColumn();
+        if (stats.m_lastFrameAllocations > 0)
+        {
+            ImGui::TextColored(ImVec4(1.f, 0.6f, 0.2f, 1.f), "%llu", static_cast<unsigned long long>(stats.m_lastFrameAllocations));
+        }
+        else
+        {
+            ImGui::TextUnformatted("0");
+        }
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(stats.m_totalAllocations));
+    }
+}
+
+void MemoryWindow::Render()
+{
+    if (!m_isOpen)
+    {
+        return;
+    }
+    if (!ImGui::Begin("Memory", &m_isOpen))
+    {
+        ImGui::End();
+        return;
+    }
+
+#if !GAME_MEMORY_TRACKING_ENABLED
+    ImGui::TextUnformatted("Built with GAME_MEMORY_TRACKING_ENABLED=0, nothing is tracked.");
+#endif
+
+    MemoryTracker::TagStats total = MemoryTracker::GetTotalStats();
+    ImGui::Text("Last frame: %llu allocations, %.1f KB. Allocation-free frames in a row: %llu",
+                static_cast<unsigned long long>(total.m_lastFrameAllocations), ToKilobytes(static_cast<int64_t>(total.m_lastFrameBytes)),
+                static_cast<unsigned long long>(MemoryTracker::GetAllocationFreeFrameCount()));
+
+    float history[MemoryTracker::HISTORY_FRAME_COUNT];
+    int   historyCount = MemoryTracker::GetFrameAllocationHistory(history, MemoryTracker::HISTORY_FRAME_COUNT);
+    if (historyCount > 0)
+    {
+        float peakCount = *std::max_element(history, history + historyCount);
+        ImGui::PlotHistogram("##FrameAllocations", history, historyCount, 0, "allocations per frame", 0.f, std::max(peakCount, 1.f), ImVec2(-1.f, 60.f));
+    }
+
+    if (g_theGameArena)
+    {
+        ImGui::Text("Game arena: %.1f of %.1f KB in %zu blocks, %zu allocations", ToKilobytes(static_cast<int64_t>(g_theGameArena->GetBytesAllocated())),
+                    ToKilobytes(static_cast<int64_t>(g_theGameArena->GetBytesReserved())), g_theGameArena->GetBlockCount(), g_theGameArena->GetAllocationCount());
+    }
+
+    if (ImGui::Button("Reset peaks"))
+    {
+        MemoryTracker::ResetPeaks();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Dump JSON"))
+    {
+        std::string path = std::string(DUMP_DIRECTORY) + "memory_" + std::to_string(m_dumpCount++) + ".json";
+        m_dumpStatus     = MemoryTracker::ExportJson(path) ? "Wrote " + path : "Failed to write " + path;
+    }
+    if (!m_dumpStatus.empty())
+    {
+        ImGui::SameLine();
+        ImGui::TextUnformatted(m_dumpStatus.c_str());
+    }
+    ImGui::Separator();
+
+    constexpr ImGuiTableFlags TABLE_FLAGS = ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("MemoryTags", 6, TABLE_FLAGS))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Tag", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Live KB", ImGuiTableColumnFlags_WidthFixed, 80.f);
+        ImGui::TableSetupColumn("Peak KB", ImGuiTableColumnFlags_WidthFixed, 80.f);
+        ImGui::TableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed, 70.f);
+        ImGui::TableSetupColumn("Frame", ImGuiTableColumnFlags_WidthFixed, 60.f);
+        ImGui::TableSetupColumn("Total", ImGuiTableColumnFlags_WidthFixed, 80.f);
+        ImGui::TableHeadersRow();
+
+        for (int tag = 0; tag < static_cast<int>(MemoryTag::COUNT); ++tag)
+        {
+            MemoryTracker::TagStats stats = MemoryTracker::GetTagStats(static_cast<MemoryTag>(tag));
+            if (stats.m_totalAllocations > 0)
+            {
+                RenderRow(MemoryTracker::GetTagName(static_cast<MemoryTag>(tag)), stats);
+            }
+        }
+        RenderRow("Total", total);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+
+//-----------------------------------------------------------------------------------------------
+// ImGui front end for the MemoryTracker: live and peak bytes, live allocations and the last
+// frame's allocations per tag, the allocations-per-frame history, the game arena's usage and a
+// JSON dump. Tags that have never allocated are hidden.
+//
+class MemoryWindow
+{
+public:
+    void Render();
+
+    bool IsOpen() const { return m_isOpen; }
+    void SetOpen(bool isOpen) { m_isOpen = isOpen; }
+
+private:
+    bool        m_isOpen    = false;
+    int         m_dumpCount = 0;
+    std::string m_dumpStatus;
+};
@@ -0,0 +1,172 @@
+#include "MessageLogBuffer.hpp"
+
+#include <cstring>
+
+namespace
+{
+    size_t RoundUpToPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+}
+
+bool MessageLogBuffer::Filter::Accepts(const Entry& entry) const
+{
+    if ((m_verbosityMask & (1u << static_cast<uint8_t>(entry.m_verbosity))) == 0)
+    {
+        return false;
+    }
+    if ((m_categoryMask & (1ull << entry.m_categoryId)) == 0)
+    {
+        return false;
+    }
+    return m_textContains.empty() || std::strstr(entry.m_text, m_textContains.c_str()) != nullptr;
+}
+
+MessageLogBuffer::MessageLogBuffer(size_t capacity)
+{
+    size_t roundedCapacity = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+    m_entries.resize(roundedCapacity);
+    m_filtered.resize(roundedCapacity);
+    m_capacityMask = roundedCapacity - 1;
+    m_categoryKeys.reserve(MAX_CATEGORIES);
+    m_categoryNames.reserve(MAX_CATEGORIES);
+    m_startTime = std::chrono::steady_clock::now();
+}
+
+void MessageLogBuffer::Receive(const GameLogCategoryBase& category, LogVerbosity verbosity, const char* message)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PushLocked(InternCategoryLocked(category.GetName(), true), verbosity, message);
+}
+
+void MessageLogBuffer::ReceiveExternal(const char* categoryName, LogVerbosity verbosity, const char* message)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PushLocked(InternCategoryLocked(categoryName, false), verbosity, message);
+}
+
+uint16_t MessageLogBuffer::InternCategory(const char* name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return InternCategoryLocked(name, false);
+}
+
+void MessageLogBuffer::Push(uint16_t categoryId, LogVerbosity verbosity, const char* message)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PushLocked(categoryId, verbosity, message);
+}
+
+void MessageLogBuffer::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_storedCount   = 0;
+    m_filteredHead  = 0;
+    m_filteredCount = 0;
+}
+
+void MessageLogBuffer::SetFilter(const Filter& filter)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_filter = filter;
+    RebuildFilteredView();
+}
+
+const MessageLogBuffer::Entry& MessageLogBuffer::GetFilteredEntry(size_t index) const
+{
+    return GetEntryBySequence(m_filtered[(m_filteredHead + index) & m_capacityMask]);
+}
+
+uint16_t MessageLogBuffer::InternCategoryLocked(const char* name, bool nameIsStatic)
+{
+    // Game category names come from static storage, so pointer identity hits on every call after the first
+    for (size_t i = 0; i < m_categoryKeys.size(); ++i)
+    {
+        if (m_categoryKeys[i] == name)
+        {
+            return static_cast<uint16_t>(i);
+        }
+    }
+    for (size_t i = 0; i < m_categoryNames.size(); ++i)
+    {
+        if (m_categoryNames[i] == name)
+        {
+            if (nameIsStatic)
+            {
+                m_categoryKeys[i] = name;
+            }
+            return static_cast<uint16_t>(i);
+        }
+    }
+    if (m_categoryNames.size() >= MAX_CATEGORIES)
+    {
+        return static_cast<uint16_t>(MAX_CATEGORIES - 1);
+    }
+    // A transient name must never become a key, its address can be reused by another string
+    m_categoryKeys.push_back(nameIsStatic ? name : nullptr);
+    m_categoryNames.emplace_back(name);
+    return static_cast<uint16_t>(m_categoryNames.size() - 1);
+}
+
+void MessageLogBuffer::PushLocked(uint16_t categoryId, LogVerbosity verbosity, const char* message)
+{
+    uint64_t sequence = m_nextSequence++;
+
+    if (m_storedCount == m_entries.size())
+    {
+        // Overwriting the oldest entry, drop it from the view if it was visible
+        uint64_t evictedSequence = sequence - m_entries.size();
+        if (m_filteredCount > 0 && m_filtered[m_filteredHead] == evictedSequence)
+        {
+            m_filteredHead = (m_filteredHead + 1) & m_capacityMask;
+            --m_filteredCount;
+        }
+    }
+    else
+    {
+        ++m_storedCount;
+    }
+
+    Entry& entry        = m_entries[sequence & m_capacityMask];
+    entry.m_sequence    = sequence;
+    entry.m_timeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+    entry.m_categoryId  = categoryId;
+    entry.m_verbosity   = verbosity;
+
+    size_t length = message ? std::strlen(message) : 0;
+    if (length >= MESSAGE_TEXT_CAPACITY)
+    {
+        length = MESSAGE_TEXT_CAPACITY - 1;
+    }
+    if (length > 0)
+    {
+        std::memcpy(entry.m_text, message, length);
+    }
+    entry.m_text[length] = '\0';
+    entry.m_textLength   = static_cast<uint8_t>(length);
+
+    if (m_filter.Accepts(entry))
+    {
+        m_filtered[(m_filteredHead + m_filteredCount) & m_capacityMask] = sequence;
+        ++m_filteredCount;
+    }
+}
+
+void MessageLogBuffer::RebuildFilteredView()
+{
+    m_filteredHead  = 0;
+    m_filteredCount = 0;
+    for (uint64_t sequence = m_nextSequence - m_storedCount; sequence < m_nextSequence; ++sequence)
+    {
+        if (m_filter.Accepts(GetEntryBySequence(sequence)))
+        {
+            m_filtered[m_filteredCount++] = sequence;
+        }
+    }
+}
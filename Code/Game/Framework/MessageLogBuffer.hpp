@@ -0,0 +1,90 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Game/Framework/GameLogCategory.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Fixed-capacity ring buffer of log messages. Memory is allocated once at construction; when the
+// buffer is full the oldest message is overwritten. Each entry stores an interned category id and
+// its verbosity so filtering never touches strings.
+//
+// The filtered view is kept incrementally: Push() appends the new sequence number to the view if it
+// passes the active filter, and overwritten entries fall off the view's front. Changing the filter
+// rebuilds the view once. Readers therefore pay O(visible rows) per frame regardless of capacity.
+//
+class MessageLogBuffer : public GameLogSink
+{
+public:
+    static constexpr int    MAX_CATEGORIES        = 64;
+    static constexpr size_t MESSAGE_TEXT_CAPACITY = 232;
+
+    struct Entry
+    {
+        uint64_t     m_sequence                    = 0;
+        double       m_timeSeconds                 = 0.0;
+        uint16_t     m_categoryId                  = 0;
+        LogVerbosity m_verbosity                   = LogVerbosity::Info;
+        uint8_t      m_textLength                  = 0;
+        char         m_text[MESSAGE_TEXT_CAPACITY] = {};
+    };
+
+    struct Filter
+    {
+        uint8_t     m_verbosityMask = 0xFF;  // bit per LogVerbosity
+        uint64_t    m_categoryMask  = ~0ull; // bit per interned category id
+        std::string m_textContains;
+
+        bool Accepts(const Entry& entry) const;
+    };
+
+    explicit MessageLogBuffer(size_t capacity = 16384);
+
+    // GameLogSink
+    void Receive(const GameLogCategoryBase& category, LogVerbosity verbosity, const char* message) override;
+    void ReceiveExternal(const char* categoryName, LogVerbosity verbosity, const char* message) override;
+
+    uint16_t InternCategory(const char* name);
+    void     Push(uint16_t categoryId, LogVerbosity verbosity, const char* message);
+    void     Clear();
+
+    void          SetFilter(const Filter& filter);
+    const Filter& GetFilter() const { return m_filter; }
+
+    /// Filtered view access, index 0 is the oldest visible message. Callers hold GetMutex().
+    size_t       GetFilteredCount() const { return m_filteredCount; }
+    const Entry& GetFilteredEntry(size_t index) const;
+
+    size_t             GetCapacity() const { return m_entries.size(); }
+    size_t             GetStoredCount() const { return m_storedCount; }
+    uint64_t           GetTotalPushed() const { return m_nextSequence; }
+    int                GetCategoryCount() const { return static_cast<int>(m_categoryNames.size()); }
+    const std::string& GetCategoryName(uint16_t categoryId) const { return m_categoryNames[categoryId]; }
+    std::mutex&        GetMutex() const { return m_mutex; }
+
+private:
+    const Entry& GetEntryBySequence(uint64_t sequence) const { return m_entries[sequence & m_capacityMask]; }
+    uint16_t     InternCategoryLocked(const char* name, bool nameIsStatic);
+    void         PushLocked(uint16_t categoryId, LogVerbosity verbosity, const char* message);
+    void         RebuildFilteredView();
+
+    std::vector<Entry> m_entries;
+    size_t             m_capacityMask = 0;
+    size_t             m_storedCount  = 0;
+    uint64_t           m_nextSequence = 0;
+
+    // Ring of sequence numbers that pass m_filter, ordered oldest to newest
+    std::vector<uint64_t> m_filtered;
+    size_t                m_filteredHead  = 0;
+    size_t                m_filteredCount = 0;
+    Filter                m_filter;
+
+    std::vector<const char*> m_categoryKeys; // pointer identity of interned names, fast path
+    std::vector<std::string> m_categoryNames;
+
+    std::chrono::steady_clock::time_point m_startTime;
+    mutable std::mutex                    m_mutex;
+};
@@ -0,0 +1,36 @@
+#include "MessageLogEngineAppender.hpp"
+
+#include "Engine/Core/Logger/LogMessage.hpp"
+#include "Game/Framework/GameLogCategory.hpp"
+
+namespace
+{
+    LogVerbosity ToVerbosity(enigma::core::LogLevel level)
+    {
+        using enigma::core::LogLevel;
+        if (level >= LogLevel::ERROR)
+        {
+            return LogVerbosity::Error;
+        }
+        if (level >= LogLevel::WARNING)
+        {
+            return LogVerbosity::Warning;
+        }
+        return level >= LogLevel::INFO ? LogVerbosity::Info : LogVerbosity::Debug;
+    }
+}
+
+void MessageLogEngineAppender::Write(const enigma::core::LogMessage& message)
+{
+    GameLogSink* sink = GameLogCategoryBase::GetSink();
+    if (!sink)
+    {
+        return;
+    }
+    const char* categoryName = message.category.c_str();
+    if (GameLogCategoryBase::FindByName(categoryName))
+    {
+        return;
+    }
+    sink->ReceiveExternal(categoryName, ToVerbosity(message.level), message.message.c_str());
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Engine/Core/Logger/LogAppender.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// MessageLogEngineAppender.hpp
+//
+// Engine logger appender that forwards everything logged through LogInfo/LogWarn/... (the engine's
+// own subsystems included) to the current GameLogSink, so the in-game message log shows engine
+// output alongside GAME_LOG calls. Categories that belong to a GameLogCategory are skipped: GAME_LOG
+// already hands those to the sink with their exact verbosity.
+//
+// The appender holds no state, so it can be registered once for the lifetime of the logger while
+// Game (and the sink it installs) comes and goes.
+//
+class MessageLogEngineAppender : public enigma::core::ILogAppender
+{
+public:
+    void Write(const enigma::core::LogMessage& message) override;
+    void Flush() override {}
+};
@@ -0,0 +1,130 @@
+#include "MessageLogWindow.hpp"
+
+#include "ThirdParty/imgui/imgui.h"
+
+namespace
+{
+    constexpr const char* VERBOSITY_NAMES[] = {"Verbose", "Debug", "Info", "Warning", "Error"};
+
+    ImVec4 GetVerbosityColor(LogVerbosity verbosity)
+    {
+        switch (verbosity)
+        {
+        case LogVerbosity::Verbose: return ImVec4(0.55f, 0.55f, 0.55f, 1.f);
+        case LogVerbosity::Debug: return ImVec4(0.60f, 0.80f, 1.00f, 1.f);
+        case LogVerbosity::Warning: return ImVec4(1.00f, 0.85f, 0.30f, 1.f);
+        case LogVerbosity::Error: return ImVec4(1.00f, 0.40f, 0.40f, 1.f);
+        default: return ImVec4(0.90f, 0.90f, 0.90f, 1.f);
+        }
+    }
+}
+
+MessageLogWindow::MessageLogWindow(size_t capacity) : m_buffer(capacity)
+{
+}
+
+void MessageLogWindow::Render()
+{
+    if (!m_isOpen)
+    {
+        return;
+    }
+    if (!ImGui::Begin("Message Log", &m_isOpen))
+    {
+        ImGui::End();
+        return;
+    }
+
+    RenderFilterBar();
+    ImGui::Separator();
+
+    ImGui::BeginChild("MessageLogRows", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+    {
+        std::lock_guard<std::mutex> lock(m_buffer.GetMutex());
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_buffer.GetFilteredCount()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const MessageLogBuffer::Entry& entry = m_buffer.GetFilteredEntry(static_cast<size_t>(row));
+                ImGui::TextColored(GetVerbosityColor(entry.m_verbosity), "[%9.3f] [%-7s] [%s] %s",
+                                   entry.m_timeSeconds,
+                                   VERBOSITY_NAMES[static_cast<int>(entry.m_verbosity)],
+                                   m_buffer.GetCategoryName(entry.m_categoryId).c_str(),
+                                   entry.m_text);
+            }
+        }
+        clipper.End();
+    }
+
+    if (m_autoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+    {
+        ImGui::SetScrollHereY(1.0f);
+    }
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+void MessageLogWindow::RenderFilterBar()
+{
+    MessageLogBuffer::Filter filter        = m_buffer.GetFilter();
+    bool                     filterChanged = false;
+
+    for (int verbosity = 0; verbosity < static_cast<int>(LogVerbosity::Off); ++verbosity)
+    {
+        bool enabled = (filter.m_verbosityMask & (1u << verbosity)) != 0;
+        if (ImGui::Checkbox(VERBOSITY_NAMES[verbosity], &enabled))
+        {
+            filter.m_verbosityMask ^= static_cast<uint8_t>(1u << verbosity);
+            filterChanged = true;
+        }
+        ImGui::SameLine();
+    }
+    ImGui::Checkbox("Auto-scroll", &m_autoScroll);
+
+    {
+        std::lock_guard<std::mutex> lock(m_buffer.GetMutex());
+        for (int categoryId = 0; categoryId < m_buffer.GetCategoryCount(); ++categoryId)
+        {
+            bool enabled = (filter.m_categoryMask & (1ull << categoryId)) != 0;
+            if (ImGui::Checkbox(m_buffer.GetCategoryName(static_cast<uint16_t>(categoryId)).c_str(), &enabled))
+            {
+                filter.m_categoryMask ^= 1ull << categoryId;
+                filterChanged = true;
+            }
+            ImGui::SameLine();
+        }
+    }
+    ImGui::NewLine();
+
+    if (ImGui::InputText("Search", m_searchText, sizeof(m_searchText)))
+    {
+        filter.m_textContains = m_searchText;
+        filterChanged         = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+    {
+        m_buffer.Clear();
+    }
+    ImGui::SameLine();
+
+    size_t   filteredCount = 0;
+    size_t   storedCount   = 0;
+    uint64_t totalPushed   = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_buffer.GetMutex());
+        filteredCount = m_buffer.GetFilteredCount();
+        storedCount   = m_buffer.GetStoredCount();
+        totalPushed   = m_buffer.GetTotalPushed();
+    }
+    ImGui::Text("%zu / %zu shown, %llu total", filteredCount, storedCount, static_cast<unsigned long long>(totalPushed));
+
+    // Rebuilding the view is the only full pass, and it only happens on user input
+    if (filterChanged)
+    {
+        m_buffer.SetFilter(filter);
+    }
+}
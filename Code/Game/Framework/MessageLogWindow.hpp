@@ -0,0 +1,27 @@
+#pragma once
+#include "Game/Framework/MessageLogBuffer.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// ImGui front end for a MessageLogBuffer. Only rows inside the scroll region are touched each frame
+// (ImGuiListClipper over the buffer's incrementally filtered view), so the per-frame cost does not
+// depend on how many messages are stored.
+//
+class MessageLogWindow
+{
+public:
+    explicit MessageLogWindow(size_t capacity = 16384);
+
+    void Render();
+
+    MessageLogBuffer& GetBuffer() { return m_buffer; }
+    bool              IsOpen() const { return m_isOpen; }
+    void              SetOpen(bool isOpen) { m_isOpen = isOpen; }
+
+private:
+    void RenderFilterBar();
+
+    MessageLogBuffer m_buffer;
+    bool             m_isOpen          = true;
+    bool             m_autoScroll      = true;
+    char             m_searchText[128] = {};
+};
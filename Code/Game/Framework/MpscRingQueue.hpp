@@ -0,0 +1,103 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------------------------
+// Bounded multi-producer / single-consumer ring queue (Vyukov's sequence-per-cell design).
+// Producers claim a cell with one CAS on the enqueue cursor and publish it with a release store of
+// the cell sequence; the consumer never writes shared cursors. No locks and no allocation after
+// construction. TryPush fails instead of blocking when the ring is full.
+//
+// T must be trivially copyable; it is copied in and out of the ring by value.
+//
+template <typename T>
+class MpscRingQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "MpscRingQueue payloads are copied bitwise");
+
+public:
+    explicit MpscRingQueue(size_t capacity)
+    {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+        m_capacityMask = roundedCapacity - 1;
+        m_cells        = std::make_unique<Cell[]>(roundedCapacity);
+        for (size_t i = 0; i < roundedCapacity; ++i)
+        {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingQueue(const MpscRingQueue&)            = delete;
+    MpscRingQueue& operator=(const MpscRingQueue&) = delete;
+
+    /// Any thread
+    bool TryPush(const T& value)
+    {
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Cell*  cell     = nullptr;
+        for (;;)
+        {
+            cell                    = &m_cells[position & m_capacityMask];
+            size_t    sequence      = cell->m_sequence.load(std::memory_order_acquire);
+            ptrdiff_t sequenceDelta = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+            if (sequenceDelta == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (sequenceDelta < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->m_value = value;
+        cell->m_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer thread only
+    bool TryPop(T& outValue)
+    {
+        Cell&  cell     = m_cells[m_dequeuePosition & m_capacityMask];
+        size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+        if (sequence != m_dequeuePosition + 1)
+        {
+            return false; // empty, or the producer that claimed this cell has not published yet
+        }
+        outValue = cell.m_value;
+        cell.m_sequence.store(m_dequeuePosition + m_capacityMask + 1, std::memory_order_release);
+        ++m_dequeuePosition;
+        return true;
+    }
+
+    size_t GetCapacity() const { return m_capacityMask + 1; }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> m_sequence{0};
+        T                   m_value;
+    };
+
+    // Read-only after construction, every thread reads these
+    size_t                  m_capacityMask = 0;
+    std::unique_ptr<Cell[]> m_cells;
+
+    // Producers hammer the enqueue cursor and the consumer writes the dequeue cursor on every pop;
+    // each gets a cache line to itself (the class is 64-aligned, so the last one is padded out too)
+    alignas(64) std::atomic<size_t> m_enqueuePosition{0};
+    alignas(64) size_t              m_dequeuePosition = 0;
+};
@@ -0,0 +1,344 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "Game/Framework/MemoryTracker.hpp"
+
+std::atomic<Profiler*> Profiler::s_active{nullptr};
+std::atomic<uint64_t>  Profiler::s_nextGeneration{1};
+
+namespace
+{
+    /// The calling thread's ring, per profiler so a new profiler never sees a dead one's buffer.
+    /// Keyed by generation: a new profiler can be allocated at a destroyed one's address.
+    struct CurrentThread
+    {
+        ~CurrentThread()
+        {
+            Profiler* active = Profiler::GetActive();
+            if (m_ownerGeneration != 0 && active && active->GetGeneration() == m_ownerGeneration)
+            {
+                active->RetireThreadBuffer(m_buffer);
+            }
+        }
+
+        uint64_t m_ownerGeneration = 0;
+        void*    m_buffer          = nullptr;
+    };
+
+    thread_local CurrentThread t_currentThread;
+
+    void WriteJsonString(FILE* file, const char* text)
+    {
+        std::fputc('"', file);
+        for (const char* character = text; *character; ++character)
+        {
+            unsigned char byte = static_cast<unsigned char>(*character);
+            if (byte < 0x20)
+            {
+                std::fprintf(file, "\\u%04x", byte); // Control characters are not allowed raw in a JSON string
+                continue;
+            }
+            if (byte == '"' || byte == '\\')
+            {
+                std::fputc('\\', file);
+            }
+            std::fputc(byte, file);
+        }
+        std::fputc('"', file);
+    }
+}
+
+Profiler::Profiler()
+{
+    MEMORY_TAG_SCOPE(MemoryTag::Profiler);
+    m_frameHistoryMs.reserve(HISTORY_FRAME_COUNT);
+    m_lastEndFrameTicks = GetTicks();
+    m_captureFramesLeft = 1; // Startup, up to the first EndFrame()
+    m_generation        = s_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+    m_previousActive    = s_active.load(std::memory_order_acquire);
+    s_active.store(this, std::memory_order_release);
+    SetThreadName("Main");
+}
+
+Profiler::~Profiler()
+{
+    Profiler* expected = this;
+    s_active.compare_exchange_strong(expected, m_previousActive, std::memory_order_acq_rel);
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    if (Profiler* active = GetActive())
+    {
+        ThreadBuffer&               buffer = active->GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(active->m_threadsMutex);
+        buffer.m_name = name;
+    }
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+    if (t_currentThread.m_ownerGeneration == m_generation)
+    {
+        return *static_cast<ThreadBuffer*>(t_currentThread.m_buffer);
+    }
+
+    // First scope on this thread, or since it last recorded into another profiler: the only time
+    // recording takes the lock. Job systems and render threads come and go (the startup tests make
+    // many), so the rings of finished threads are reused.
+    MEMORY_TAG_SCOPE(MemoryTag::Profiler);
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    std::thread::id             thisThread = std::this_thread::get_id();
+    for (const std::unique_ptr<ThreadBuffer>& existing : m_threads)
+    {
+        if (existing->m_thread == thisThread && !existing->m_isRetired.load(std::memory_order_relaxed))
+        {
+            t_currentThread.m_ownerGeneration = m_generation;
+            t_currentThread.m_buffer          = existing.get();
+            return *existing;
+        }
+    }
+    for (const std::unique_ptr<ThreadBuffer>& retired : m_threads)
+    {
+        if (retired->m_isRetired.load(std::memory_order_acquire) &&
+            retired->m_readCount.load(std::memory_order_relaxed) == retired->m_writeCount.load(std::memory_order_relaxed))
+        {
+            retired->m_isRetired.store(false, std::memory_order_relaxed);
+            retired->m_thread                 = thisThread;
+            retired->m_name                   = "Thread " + std::to_string(retired->m_threadId);
+            retired->m_depth                  = 0;
+            t_currentThread.m_ownerGeneration = m_generation;
+            t_currentThread.m_buffer          = retired.get();
+            return *retired;
+        }
+    }
+
+    std::unique_ptr<ThreadBuffer> buffer = std::make_unique<ThreadBuffer>();
+    buffer->m_threadId                   = static_cast<uint32_t>(m_threads.size());
+    buffer->m_thread                     = thisThread;
+    buffer->m_name                       = "Thread " + std::to_string(buffer->m_threadId);
+    buffer->m_events                     = std::make_unique<Event[]>(THREAD_EVENT_CAPACITY);
+    t_currentThread.m_ownerGeneration    = m_generation;
+    t_currentThread.m_buffer             = buffer.get();
+    m_threads.push_back(std::move(buffer));
+    return *m_threads.back();
+}
+
+void Profiler::RetireThreadBuffer(void* buffer)
+{
+    static_cast<ThreadBuffer*>(buffer)->m_isRetired.store(true, std::memory_order_release);
+}
+
+uint32_t Profiler::BeginScope()
+{
+    return GetThreadBuffer().m_depth++;
+}
+
+void Profiler::EndScope(Event& event)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    --buffer.m_depth;
+    event.m_threadId = buffer.m_threadId;
+
+    uint64_t writeCount = buffer.m_writeCount.load(std::memory_order_relaxed);
+    if (writeCount - buffer.m_readCount.load(std::memory_order_acquire) >= THREAD_EVENT_CAPACITY)
+    {
+        buffer.m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer.m_events[writeCount % THREAD_EVENT_CAPACITY] = event;
+    buffer.m_writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+void Profiler::EndFrame()
+{
+    MEMORY_TAG_SCOPE(MemoryTag::Profiler);
+    m_frameEvents.clear();
+    size_t threadCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        threadCount = m_threads.size();
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_threads)
+        {
+            uint64_t readCount  = buffer->m_readCount.load(std::memory_order_relaxed);
+            uint64_t writeCount = buffer->m_writeCount.load(std::memory_order_acquire);
+            for (; readCount < writeCount; ++readCount)
+            {
+                m_frameEvents.push_back(buffer->m_events[readCount % THREAD_EVENT_CAPACITY]);
+            }
+            buffer->m_readCount.store(readCount, std::memory_order_release);
+        }
+    }
+
+    if (m_captureFramesLeft > 0)
+    {
+        m_captureEvents.insert(m_captureEvents.end(), m_frameEvents.begin(), m_frameEvents.end());
+        --m_captureFramesLeft;
+    }
+
+    int64_t now              = GetTicks();
+    m_lastFrame.m_frameIndex = m_frameCount++;
+    m_lastFrame.m_durationMs = static_cast<double>(now - m_lastEndFrameTicks) * 1e-6;
+    m_lastEndFrameTicks      = now;
+    BuildFrame(m_frameEvents, threadCount);
+
+    if (m_frameHistoryMs.size() == HISTORY_FRAME_COUNT)
+    {
+        m_frameHistoryMs.erase(m_frameHistoryMs.begin());
+    }
+    m_frameHistoryMs.push_back(static_cast<float>(m_lastFrame.m_durationMs));
+}
+
+void Profiler::BuildFrame(std::vector<Event>& events, size_t threadCount)
+{
+    // Per thread in start order; an enclosing scope starts no later than its children and is shallower
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b)
+    {
+        if (a.m_threadId != b.m_threadId)
+        {
+            return a.m_threadId < b.m_threadId;
+        }
+        if (a.m_beginTicks != b.m_beginTicks)
+        {
+            return a.m_beginTicks < b.m_beginTicks;
+        }
+        return a.m_depth < b.m_depth;
+    });
+
+    std::vector<Node>& nodes      = m_lastFrame.m_nodes;
+    std::vector<int>&  firstRoots = m_lastFrame.m_firstRoots;
+    nodes.clear();
+    firstRoots.assign(threadCount, -1);
+
+    uint32_t threadId = ~0u;
+    m_openNodes.clear();
+    for (const Event& event : events)
+    {
+        if (event.m_threadId != threadId)
+        {
+            threadId = event.m_threadId;
+            m_openNodes.clear();
+        }
+        // A scope whose parent opened in an earlier frame hangs off the deepest one still known
+        m_openNodes.resize(std::min<size_t>(m_openNodes.size(), event.m_depth));
+        int parent = m_openNodes.empty() ? -1 : m_openNodes.back();
+
+        // Repeated calls under one parent merge into one node by name text, as one literal can have
+        // several addresses across translation units; sibling lists are short
+        int* link      = parent < 0 ? &firstRoots[threadId] : &nodes[parent].m_firstChild;
+        int  nodeIndex = -1;
+        while (*link >= 0)
+        {
+            if (std::strcmp(nodes[*link].m_name, event.m_name) == 0)
+            {
+                nodeIndex = *link;
+                break;
+            }
+            link = &nodes[*link].m_nextSibling;
+        }
+        if (nodeIndex < 0)
+        {
+            Node node;
+            node.m_name     = event.m_name;
+            node.m_parent   = parent;
+            node.m_threadId = threadId;
+            node.m_depth    = parent < 0 ? 0 : nodes[parent].m_depth + 1;
+            nodeIndex       = static_cast<int>(nodes.size());
+            *link           = nodeIndex; // Before the push_back, which may move the node link points into
+            nodes.push_back(node);
+        }
+
+        Node& node = nodes[nodeIndex];
+        node.m_callCount++;
+        node.m_inclusiveMs += static_cast<double>(event.m_endTicks - event.m_beginTicks) * 1e-6;
+        m_openNodes.push_back(nodeIndex);
+    }
+
+    for (Node& node : nodes)
+    {
+        node.m_exclusiveMs = node.m_inclusiveMs;
+    }
+    for (const Node& node : nodes)
+    {
+        if (node.m_parent >= 0)
+        {
+            nodes[node.m_parent].m_exclusiveMs -= node.m_inclusiveMs;
+        }
+    }
+}
+
+void Profiler::StartCapture(int frameCount)
+{
+    m_captureEvents.clear();
+    m_captureFramesLeft = std::max(frameCount, 0);
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) const
+{
+    std::filesystem::path filePath(path);
+    std::error_code       error;
+    if (filePath.has_parent_path())
+    {
+        std::filesystem::create_directories(filePath.parent_path(), error);
+    }
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+
+    int64_t originTicks = 0;
+    if (!m_captureEvents.empty())
+    {
+        originTicks = std::min_element(m_captureEvents.begin(), m_captureEvents.end(), [](const Event& a, const Event& b)
+        {
+            return a.m_beginTicks < b.m_beginTicks;
+        })->m_beginTicks;
+    }
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    bool isFirst = true;
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_threads)
+        {
+            std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", isFirst ? "" : ",\n", buffer->m_threadId);
+            WriteJsonString(file, buffer->m_name.c_str());
+            std::fputs("}}", file);
+            isFirst = false;
+        }
+    }
+    for (const Event& event : m_captureEvents)
+    {
+        // Complete events in microseconds from the first scope of the capture
+        std::fprintf(file, "%s{\"name\":", isFirst ? "" : ",\n");
+        WriteJsonString(file, event.m_name);
+        std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.m_threadId,
+                     static_cast<double>(event.m_beginTicks - originTicks) * 1e-3,
+                     static_cast<double>(event.m_endTicks - event.m_beginTicks) * 1e-3);
+        isFirst = false;
+    }
+    std::fputs("\n]}\n", file);
+    return std::fclose(file) == 0;
+}
+
+std::string Profiler::GetThreadName(uint32_t threadId) const
+{
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    return threadId < m_threads.size() ? m_threads[threadId]->m_name : std::string();
+}
+
+uint64_t Profiler::GetDroppedEventCount() const
+{
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    uint64_t                    droppedCount = 0;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : m_threads)
+    {
+        droppedCount += buffer->m_droppedCount.load(std::memory_order_relaxed);
+    }
+    return droppedCount;
+}
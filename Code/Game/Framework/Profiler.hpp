@@ -0,0 +1,205 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------------------------
+// Profiler.hpp
+//
+// Hierarchical CPU profiler. PROFILE_SCOPE("Name") times the enclosing block on whatever thread
+// runs it. Each thread records completed scopes into its own single-producer ring, so recording
+// takes no lock and shares no cache line with other threads; the main thread drains every ring in
+// EndFrame() and merges the scopes into a per-thread call tree for that frame.
+//
+// A capture keeps the raw scopes of the next N frames for ExportChromeTrace(), which writes the
+// trace-event JSON chrome://tracing and Perfetto load. The first capture starts when the profiler
+// is created and ends at the first EndFrame(), so startup is always available as a trace.
+//
+// Scope names must be string literals (or otherwise outlive the profiler); only the pointer is
+// stored, though nodes merge by the name's text. With GAME_PROFILER_ENABLED=0 the macro compiles to
+// nothing; otherwise a scope costs one relaxed load while recording is off, and two clock reads and
+// a ring write while it is on.
+//
+// The newest profiler is the active one until it is destroyed, which reactivates the one before
+// (tests profile into their own without disturbing the game's).
+//
+// Usage:
+//   App.cpp:   g_theProfiler = new Profiler(); ... g_theProfiler->EndFrame(); once per frame
+//   Anywhere:  PROFILE_SCOPE("Game::Update");
+//   Threads:   Profiler::SetThreadName("Render"); before their first scope
+//
+
+/// Build-wide switch. Override from the project preprocessor definitions, e.g. GAME_PROFILER_ENABLED=0
+#ifndef GAME_PROFILER_ENABLED
+#define GAME_PROFILER_ENABLED 1
+#endif
+
+class Profiler
+{
+public:
+    static constexpr size_t THREAD_EVENT_CAPACITY = 16384; // Per thread and frame, more are dropped
+    static constexpr int    HISTORY_FRAME_COUNT   = 240;
+
+    /// One completed scope as recorded by its thread
+    struct Event
+    {
+        const char* m_name       = nullptr;
+        int64_t     m_beginTicks = 0; // Nanoseconds on the steady clock
+        int64_t     m_endTicks   = 0;
+        uint32_t    m_depth      = 0;
+        uint32_t    m_threadId   = 0;
+    };
+
+    /// Calls of one scope name under one parent within a frame, merged
+    struct Node
+    {
+        const char* m_name        = nullptr;
+        int         m_parent      = -1; // Index into the frame's nodes, -1 for a root
+        uint32_t    m_threadId    = 0;
+        uint32_t    m_depth       = 0;
+        int         m_callCount   = 0;
+        double      m_inclusiveMs = 0.0;
+        double      m_exclusiveMs = 0.0; // Inclusive minus the children's inclusive time
+        int         m_firstChild  = -1;
+        int         m_nextSibling = -1;  // In first-call order
+    };
+
+    /// Every node a frame recorded, parents before their children
+    struct Frame
+    {
+        uint64_t          m_frameIndex = 0;
+        double            m_durationMs = 0.0; // From the previous EndFrame() to this one
+        std::vector<Node> m_nodes;
+        std::vector<int>  m_firstRoots; // Per thread id, -1 when the thread recorded nothing
+    };
+
+    Profiler();
+    ~Profiler();
+    Profiler(const Profiler&)            = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// Names the calling thread in the panel and in exported traces
+    static void SetThreadName(const char* name);
+
+    /// Main thread, once per frame: drains every thread's scopes and builds the frame's tree
+    void EndFrame();
+
+    void SetRecording(bool isRecording) { m_isRecording.store(isRecording, std::memory_order_relaxed); }
+    bool IsRecording() const { return m_isRecording.load(std::memory_order_relaxed); }
+
+    /// Keeps the raw scopes of the next frameCount frames, replacing the previous capture
+    void StartCapture(int frameCount);
+    bool IsCapturing() const { return m_captureFramesLeft > 0; }
+    int  GetCaptureEventCount() const { return static_cast<int>(m_captureEvents.size()); }
+    /// Writes the last capture as Chrome trace-event JSON, creating missing directories
+    bool ExportChromeTrace(const std::string& path) const;
+
+    /// The frame last built by EndFrame(); frame 0 is startup
+    const Frame& GetLastFrame() const { return m_lastFrame; }
+    /// Frame durations, oldest first
+    const std::vector<float>& GetFrameHistoryMs() const { return m_frameHistoryMs; }
+    std::string               GetThreadName(uint32_t threadId) const;
+    uint64_t                  GetDroppedEventCount() const;
+
+    // Used by ProfileScope: BeginScope() returns the nesting depth, EndScope() records the event
+    static Profiler* GetActive() { return s_active.load(std::memory_order_acquire); }
+    /// Unique per profiler instance, unlike its address, which a later profiler can reuse
+    uint64_t         GetGeneration() const { return m_generation; }
+    uint32_t         BeginScope();
+    void             EndScope(Event& event);
+    /// Called as a recording thread exits
+    void RetireThreadBuffer(void* buffer);
+
+    static int64_t GetTicks()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    /// Written only by its thread, read only by EndFrame(). Handed to a new thread once its own
+    /// has exited and every event it wrote has been drained.
+    struct ThreadBuffer
+    {
+        uint32_t                 m_threadId = 0;
+        std::thread::id          m_thread;
+        std::string              m_name;
+        std::unique_ptr<Event[]> m_events;
+        uint32_t                 m_depth = 0;
+        std::atomic<uint64_t>    m_droppedCount{0};
+        std::atomic<bool>        m_isRetired{false};
+
+        alignas(64) std::atomic<uint64_t> m_writeCount{0};
+        alignas(64) std::atomic<uint64_t> m_readCount{0};
+    };
+
+    ThreadBuffer& GetThreadBuffer();
+    void          BuildFrame(std::vector<Event>& events, size_t threadCount);
+
+    static std::atomic<Profiler*> s_active; // Read by every recording thread
+    static std::atomic<uint64_t>  s_nextGeneration;
+    Profiler*                     m_previousActive = nullptr;
+    uint64_t                      m_generation     = 0;
+
+    std::atomic<bool> m_isRecording{true};
+
+    mutable std::mutex                         m_threadsMutex; // Guards the list, not the rings
+    std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+
+    std::vector<Event> m_frameEvents; // Scratch for EndFrame()
+    std::vector<int>   m_openNodes;   // Scratch for BuildFrame(), index is depth
+    Frame              m_lastFrame;
+    std::vector<float> m_frameHistoryMs;
+    int64_t            m_lastEndFrameTicks = 0;
+    uint64_t           m_frameCount        = 0;
+
+    std::vector<Event> m_captureEvents;
+    int                m_captureFramesLeft = 0;
+};
+
+/// Times its own lifetime into the active profiler. Use through PROFILE_SCOPE.
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+    {
+        Profiler* profiler = Profiler::GetActive();
+        if (profiler && profiler->IsRecording())
+        {
+            m_profiler           = profiler;
+            m_event.m_name       = name;
+            m_event.m_depth      = profiler->BeginScope();
+            m_event.m_beginTicks = Profiler::GetTicks();
+        }
+    }
+
+    ~ProfileScope()
+    {
+        if (m_profiler)
+        {
+            m_event.m_endTicks = Profiler::GetTicks();
+            m_profiler->EndScope(m_event);
+        }
+    }
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler*       m_profiler = nullptr;
+    Profiler::Event m_event;
+};
+
+#define PROFILE_CONCATENATE_INNER(a, b) a##b
+#define PROFILE_CONCATENATE(a, b)       PROFILE_CONCATENATE_INNER(a, b)
+
+#if GAME_PROFILER_ENABLED
+#define PROFILE_SCOPE(Name) ProfileScope PROFILE_CONCATENATE(profileScope_, __LINE__)(Name)
+#else
+#define PROFILE_SCOPE(Name) ((void)0)
+#endif
@@ -0,0 +1,145 @@
+#include "ProfilerWindow.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "ThirdParty/imgui/imgui.h"
+
+namespace
+{
+    constexpr const char* TRACE_DIRECTORY = ".enigma/profile/";
+}
+
+void ProfilerWindow::Render()
+{
+    Profiler* profiler = Profiler::GetActive();
+    if (!m_isOpen || !profiler)
+    {
+        return;
+    }
+    if (!ImGui::Begin("Profiler", &m_isOpen))
+    {
+        ImGui::End();
+        return;
+    }
+
+    RenderControls(*profiler);
+    ImGui::Separator();
+
+    const Profiler::Frame& frame = m_isPaused ? m_pausedFrame : profiler->GetLastFrame();
+    ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(frame.m_frameIndex), frame.m_durationMs);
+
+    constexpr ImGuiTableFlags TABLE_FLAGS = ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("ProfilerTree", 4, TABLE_FLAGS))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Incl ms", ImGuiTableColumnFlags_WidthFixed, 70.f);
+        ImGui::TableSetupColumn("Excl ms", ImGuiTableColumnFlags_WidthFixed, 70.f);
+        ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 50.f);
+        ImGui::TableHeadersRow();
+
+        for (size_t threadId = 0; threadId < frame.m_firstRoots.size(); ++threadId)
+        {
+            if (frame.m_firstRoots[threadId] < 0)
+            {
+                continue;
+            }
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            std::string threadName = profiler->GetThreadName(static_cast<uint32_t>(threadId));
+            if (ImGui::TreeNodeEx(threadName.c_str(), ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_SpanFullWidth))
+            {
+                for (int root = frame.m_firstRoots[threadId]; root >= 0; root = frame.m_nodes[root].m_nextSibling)
+                {
+                    RenderNode(frame, root);
+                }
+                ImGui::TreePop();
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+void ProfilerWindow::RenderControls(Profiler& profiler)
+{
+    bool isRecording = profiler.IsRecording();
+    if (ImGui::Checkbox("Record", &isRecording))
+    {
+        profiler.SetRecording(isRecording);
+    }
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Pause", &m_isPaused) && m_isPaused)
+    {
+        m_pausedFrame = profiler.GetLastFrame();
+    }
+    ImGui::SameLine();
+    ImGui::Text("Dropped scopes: %llu", static_cast<unsigned long long>(profiler.GetDroppedEventCount()));
+
+    const std::vector<float>& history = profiler.GetFrameHistoryMs();
+    if (!history.empty())
+    {
+        float peakMs = *std::max_element(history.begin(), history.end());
+        char  overlay[48];
+        std::snprintf(overlay, sizeof(overlay), "last %.2f ms, peak %.2f ms", history.back(), peakMs);
+        ImGui::PlotLines("##FrameTimes", history.data(), static_cast<int>(history.size()), 0, overlay, 0.f, std::max(peakMs, 1.f), ImVec2(-1.f, 60.f));
+    }
+
+    ImGui::SetNextItemWidth(100.f);
+    ImGui::InputInt("Frames", &m_captureFrames);
+    m_captureFrames = std::max(m_captureFrames, 1);
+    ImGui::SameLine();
+    if (profiler.IsCapturing())
+    {
+        ImGui::Text("Capturing... %d scopes", profiler.GetCaptureEventCount());
+    }
+    else if (ImGui::Button("Capture"))
+    {
+        profiler.StartCapture(m_captureFrames);
+        m_exportStatus.clear();
+    }
+    ImGui::SameLine();
+    if (!profiler.IsCapturing() && ImGui::Button("Export Chrome trace"))
+    {
+        // Until the first Capture press this exports the startup capture
+        std::string path = std::string(TRACE_DIRECTORY) + "trace_" + std::to_string(m_exportCount++) + ".json";
+        m_exportStatus   = profiler.ExportChromeTrace(path) ? "Wrote " + path : "Failed to write " + path;
+    }
+    if (!m_exportStatus.empty())
+    {
+        ImGui::TextUnformatted(m_exportStatus.c_str());
+    }
+}
+
+void ProfilerWindow::RenderNode(const Profiler::Frame& frame, int nodeIndex) const
+{
+    const Profiler::Node& node = frame.m_nodes[nodeIndex];
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanFullWidth;
+    flags |= node.m_firstChild < 0 ? ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen : ImGuiTreeNodeFlags_None;
+    flags |= node.m_depth < 2 ? ImGuiTreeNodeFlags_DefaultOpen : ImGuiTreeNodeFlags_None;
+    // The id is the node index, which follows first-call order and so holds while the frame's
+    // scope layout does. The name is only drawn, so a "##" in it is not read as part of an id.
+    ImGui::PushID(nodeIndex);
+    bool isOpen = ImGui::TreeNodeEx("Node", flags, "%s", node.m_name);
+
+    ImGui::TableNextColumn();
+    ImGui::Text("%.3f", node.m_inclusiveMs);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.3f", node.m_exclusiveMs);
+    ImGui::TableNextColumn();
+    ImGui::Text("%d", node.m_callCount);
+
+    if (isOpen && node.m_firstChild >= 0)
+    {
+        for (int child = node.m_firstChild; child >= 0; child = frame.m_nodes[child].m_nextSibling)
+        {
+            RenderNode(frame, child);
+        }
+        ImGui::TreePop();
+    }
+    ImGui::PopID();
+}
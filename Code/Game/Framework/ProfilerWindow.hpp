@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+
+#include "Game/Framework/Profiler.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// ImGui front end for a Profiler: the frame time history, the last frame's call tree per thread
+// (inclusive and exclusive milliseconds, call counts) and capture / Chrome trace export. Pausing
+// keeps showing the frame that was current when it was paused.
+//
+class ProfilerWindow
+{
+public:
+    static constexpr int DEFAULT_CAPTURE_FRAMES = 120;
+
+    void Render();
+
+    bool IsOpen() const { return m_isOpen; }
+    void SetOpen(bool isOpen) { m_isOpen = isOpen; }
+
+private:
+    void RenderControls(Profiler& profiler);
+    void RenderNode(const Profiler::Frame& frame, int nodeIndex) const;
+
+    bool            m_isOpen        = false;
+    bool            m_isPaused      = false;
+    int             m_captureFrames = DEFAULT_CAPTURE_FRAMES;
+    int             m_exportCount   = 0;
+    std::string     m_exportStatus;
+    Profiler::Frame m_pausedFrame;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+//-----------------------------------------------------------------------------------------------
+// 64-bit FNV-1a string hashing usable in constant expressions. Hashing a string literal into a
+// constexpr variable moves all string work to compile time, leaving integer compares at runtime:
+//
+//   constexpr uint64_t SCREEN_SIZE_X = HashString64("screenSizeX");
+//
+constexpr uint64_t FNV1A_64_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV1A_64_PRIME        = 1099511628211ull;
+
+constexpr uint64_t HashString64(std::string_view text)
+{
+    uint64_t hash = FNV1A_64_OFFSET_BASIS;
+    for (char character : text)
+    {
+        hash ^= static_cast<uint8_t>(character);
+        hash *= FNV1A_64_PRIME;
+    }
+    return hash;
+}
+
+/// Hasher for unordered containers whose keys are already HashString64 results.
+struct PrehashedKeyHasher
+{
+    size_t operator()(uint64_t hash) const { return static_cast<size_t>(hash ^ (hash >> 32)); }
+};
+
+/// A name reduced to its HashString64 value, constructible from a literal in constant expressions.
+struct HashedName
+{
+    constexpr HashedName(const char* text) : m_hash(HashString64(text)) {}
+    constexpr HashedName(std::string_view text) : m_hash(HashString64(text)) {}
+    HashedName(const std::string& text) : m_hash(HashString64(text)) {}
+    constexpr explicit HashedName(uint64_t hash) : m_hash(hash) {}
+
+    constexpr bool operator==(const HashedName& other) const { return m_hash == other.m_hash; }
+    constexpr bool operator!=(const HashedName& other) const { return m_hash != other.m_hash; }
+
+    uint64_t m_hash = 0;
+};
@@ -0,0 +1,50 @@
+#include "TypedBlackboard.hpp"
+
+void TypedBlackboard::PopulateFromXmlElementAttributes(const XmlElement& element)
+{
+    for (auto attribute = element.FirstAttribute(); attribute; attribute = attribute->Next())
+    {
+        SetValue(HashedName(std::string_view(attribute->Name())), attribute->Value());
+    }
+}
+
+void TypedBlackboard::SetValue(HashedName key, std::string_view text)
+{
+    m_values[key.m_hash] = ConfigValue::Parse(text);
+}
+
+float TypedBlackboard::GetValue(HashedName key, float defaultValue) const
+{
+    const ConfigValue* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_FLOAT) ? static_cast<float>(value->m_float) : defaultValue;
+}
+
+int TypedBlackboard::GetValue(HashedName key, int defaultValue) const
+{
+    const ConfigValue* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_INT) ? static_cast<int>(value->m_int) : defaultValue;
+}
+
+bool TypedBlackboard::GetValue(HashedName key, bool defaultValue) const
+{
+    const ConfigValue* value = Find(key);
+    return value && value->Is(ConfigValue::TYPE_BOOL) ? value->m_bool : defaultValue;
+}
+
+std::string TypedBlackboard::GetValue(HashedName key, const std::string& defaultValue) const
+{
+    const ConfigValue* value = Find(key);
+    return value ? value->m_string : defaultValue;
+}
+
+std::string TypedBlackboard::GetValue(HashedName key, const char* defaultValue) const
+{
+    const ConfigValue* value = Find(key);
+    return value ? value->m_string : std::string(defaultValue);
+}
+
+const ConfigValue* TypedBlackboard::Find(HashedName key) const
+{
+    auto found = m_values.find(key.m_hash);
+    return found != m_values.end() ? &found->second : nullptr;
+}
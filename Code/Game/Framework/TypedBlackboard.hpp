@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/ConfigValue.hpp"
+#include "Game/Framework/StringHash.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Blackboard keyed by compile-time hashed names with values parsed once at population time.
+// Lookups are one integer-keyed probe and never re-parse text, unlike the NamedStrings blackboard
+// that re-parses on every GetValue. Keep keys as constexpr HashedName so hashing also happens at
+// compile time (see the CONFIG_* keys in GameCommon.hpp).
+//
+class TypedBlackboard
+{
+public:
+    void PopulateFromXmlElementAttributes(const XmlElement& element);
+    void SetValue(HashedName key, std::string_view text);
+    void Clear() { m_values.clear(); }
+
+    bool   HasValue(HashedName key) const { return Find(key) != nullptr; }
+    size_t GetValueCount() const { return m_values.size(); }
+
+    float       GetValue(HashedName key, float defaultValue) const;
+    int         GetValue(HashedName key, int defaultValue) const;
+    bool        GetValue(HashedName key, bool defaultValue) const;
+    std::string GetValue(HashedName key, const std::string& defaultValue) const;
+    std::string GetValue(HashedName key, const char* defaultValue) const;
+
+private:
+    const ConfigValue* Find(HashedName key) const;
+
+    std::unordered_map<uint64_t, ConfigValue, PrehashedKeyHasher> m_values;
+};
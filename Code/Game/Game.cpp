@@ -1,9 +1,10 @@
 ﻿#include <Game/Game.hpp>
 
+#include <cstdio>
+
 #include "App.hpp"
 #include "GameCommon.hpp"
 #include "Player.hpp"
-#include "Prop.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/FileUtils.hpp"
@@ -22,7 +23,17 @@
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Resource/ResourceCommon.hpp"
 #include "Engine/Audio/AudioSubsystem.hpp"
-#include "Engine/Core/Yaml.hpp"
+#include "Game/Framework/CompiledConfig.hpp"
+#include "Game/Framework/TypedBlackboard.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/Framework/JobSystem.hpp"
+#include "Game/Framework/GameArena.hpp"
+#include "Game/Framework/Profiler.hpp"
+#include "Game/Collision/SpatialHashGrid.hpp"
+#include "Game/Render/Frustum.hpp"
+#include "Game/Render/RenderDevice.hpp"
+#include "Game/Render/RenderSnapshot.hpp"
+#include "GameEvents.hpp"
 
 // ImGui system integration
 #include "Engine/Core/ImGui/ImGuiSubsystem.hpp"
@@ -33,131 +44,124 @@
 #include "Engine/Core/LogCategory/PredefinedCategories.hpp"
 
 // Define game-specific log categories
-DEFINE_LOG_CATEGORY(LogGame);
-DEFINE_LOG_CATEGORY(LogPlayer);
-DEFINE_LOG_CATEGORY(LogAI);
+DEFINE_GAME_LOG_CATEGORY(LogGame)
+DEFINE_GAME_LOG_CATEGORY(LogPlayer)
+DEFINE_GAME_LOG_CATEGORY(LogAI)
 
 Game::Game()
+    : m_entities(g_theGameArena)
+    , m_broadphase(Vec2(-WORLD_CENTER_X, -WORLD_CENTER_Y), Vec2(WORLD_CENTER_X, WORLD_CENTER_Y), COLLISION_CELL_SIZE, g_theGameArena)
+    , m_collisionWorld(m_broadphase, g_theGameArena)
 {
     /// Resource
-    g_theRenderer->CreateOrGetTexture(".enigma/assets/default/textures/test/TestUV.png");
-    g_theRenderer->CreateOrGetTexture(".enigma/assets/default/textures/test/Caizii.png");
+    g_theRenderDevice->CreateOrGetTexture(".enigma/assets/default/textures/test/TestUV.png");
+    g_theRenderDevice->CreateOrGetTexture(".enigma/assets/default/textures/test/Caizii.png");
 
-    /// Rasterize
-    g_theRenderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_BACK);
+    m_isHeadless = g_theRenderDevice->IsHeadless();
 
     /// Spaces
     m_screenSpace.m_mins = Vec2::ZERO;
-    m_screenSpace.m_maxs = Vec2(g_gameConfigBlackboard.GetValue("screenSizeX", 1600.f), g_gameConfigBlackboard.GetValue("screenSizeY", 800.f));
+    m_screenSpace.m_maxs = Vec2(g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_X, 1600.f), g_gameConfig.GetValue(CONFIG_SCREEN_SIZE_Y, 800.f));
 
     m_worldSpace.m_mins = Vec2::ZERO;
-    m_worldSpace.m_maxs = Vec2(g_gameConfigBlackboard.GetValue("worldSizeX", 200.f), g_gameConfigBlackboard.GetValue("worldSizeY", 100.f));
+    m_worldSpace.m_maxs = Vec2(g_gameConfig.GetValue(CONFIG_WORLD_SIZE_X, 200.f), g_gameConfig.GetValue(CONFIG_WORLD_SIZE_Y, 100.f));
 
     /// Cameras
-    m_screenCamera         = new Camera();
+    m_screenCamera         = g_theGameArena->New<Camera>();
     m_screenCamera->m_mode = eMode_Orthographic;
     m_screenCamera->SetOrthographicView(Vec2::ZERO, m_screenSpace.m_maxs);
     ///
 
     /// Clock
-    m_clock = new Clock(Clock::GetSystemClock());
+    m_clock = g_theGameArena->New<Clock>(Clock::GetSystemClock());
     ///
 
     /// Player
-    m_player             = new Player(this);
-    m_player->m_position = Vec3(-2, 0, 1);
+    m_player = g_theGameArena->New<Player>(this);
+    m_player->SetPosition(Vec3(-2, 0, 1));
     /// 
 
     /// Cube
-    m_cube   = new Prop(this);
-    m_cube_1 = new Prop(this);
-
-    AddVertsForCube3D(m_cube->m_vertexes, Rgba8(255, 0, 0), Rgba8(0, 255, 255), Rgba8(0, 255, 0), Rgba8(255, 0, 255), Rgba8(0, 0, 255), Rgba8(255, 255, 0));
-    AddVertsForCube3D(m_cube_1->m_vertexes, Rgba8(255, 0, 0), Rgba8(0, 255, 255), Rgba8(0, 255, 0), Rgba8(255, 0, 255), Rgba8(0, 0, 255), Rgba8(255, 255, 0));
-
-    m_cube->m_position   = Vec3(2, 2, 0);
-    m_cube_1->m_position = Vec3(-2, -2, 0);
+    // Both cubes share one mesh and draw as instances, they differ only by transform and tint
+    std::vector<Vertex_PCU>   cubeVertexes;
+    std::vector<unsigned int> cubeIndexes;
+    AddVertsForIndexedCube3D(cubeVertexes, cubeIndexes, Rgba8(255, 0, 0), Rgba8(0, 255, 255), Rgba8(0, 255, 0), Rgba8(255, 0, 255), Rgba8(0, 0, 255), Rgba8(255, 255, 0));
+    uint16_t cubeMesh = m_entityRenderer.RegisterMesh(cubeVertexes, cubeIndexes);
+
+    m_cube   = SpawnEntity(Vec3(2, 2, 0), cubeMesh);
+    m_cube_1 = SpawnEntity(Vec3(-2, -2, 0), cubeMesh);
+    m_entities.SetAngularVelocity(m_cube, EulerAngles(0.f, 30.f, 30.f));
+    m_collisionWorld.AddBox(m_entities, m_cube, Vec3(0.5f, 0.5f, 0.5f));
+    m_collisionWorld.AddBox(m_entities, m_cube_1, Vec3(0.5f, 0.5f, 0.5f));
     ///
 
     /// Test Prop
-    m_testProp             = new Prop(this);
-    m_testProp->m_position = Vec3(0, 0, 0);
     //AddVertsForCylinder3D(m_testProp->m_vertexes,Vec3(0,2,0),Vec3(0,0,0),1);
     //AddVertsForCone3D(m_testProp->m_vertexes,Vec3(0,2,0),Vec3(0,0,0),1);
-    AddVertsForArrow3D(m_testProp->m_vertexes, Vec3(0, 2, 0), Vec3(0, 0, 0), 0.1f, 0.4f);
+    std::vector<Vertex_PCU>   arrowTriangles;
+    std::vector<Vertex_PCU>   arrowVertexes;
+    std::vector<unsigned int> arrowIndexes;
+    AddVertsForArrow3D(arrowTriangles, Vec3(0, 2, 0), Vec3(0, 0, 0), 0.1f, 0.4f);
+    WeldTriangleList(arrowTriangles, arrowVertexes, arrowIndexes);
+    m_testProp = SpawnEntity(Vec3(0, 0, 0), m_entityRenderer.RegisterMesh(arrowVertexes, arrowIndexes));
+    m_entities.SetHidden(m_testProp, true);
     /// 
 
     /// Ball
-    m_ball             = new Prop(this);
-    m_ball->m_position = Vec3(10, -5, 1);
-    m_ball->m_texture  = g_theRenderer->CreateOrGetTexture("Data/Images/TestUV.png");
-    //m_ball->m_texture = g_theRenderer->CreateOrGetTextureFromFile("Data/Images/Caizii.png");
-    AddVertsForSphere3D(m_ball->m_vertexes, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, 64, 32);
+    Texture*                  ballTexture = g_theRenderDevice->CreateOrGetTexture("Data/Images/TestUV.png");
+    std::vector<Vertex_PCU>   ballVertexes;
+    std::vector<unsigned int> ballIndexes;
+    //ballTexture = g_theRenderer->CreateOrGetTextureFromFile("Data/Images/Caizii.png");
+    AddVertsForIndexedSphere3D(ballVertexes, ballIndexes, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, 64, 32);
+    m_ballMesh = m_entityRenderer.RegisterMesh(ballVertexes, ballIndexes, ballTexture);
+    ToggleBall();
     /// 
 
     /// Grid
-    m_grid_x = new Prop(this);
-    AddVertsForCube3D(m_grid_x->m_vertexes, Rgba8::RED);
-    m_grid_x->m_scale = Vec3(GRID_SIZE * 2.f, 0.1f, 0.1f);
-    m_grid_y          = new Prop(this);
-
-    AddVertsForCube3D(m_grid_y->m_vertexes, Rgba8::GREEN);
-    m_grid_y->m_scale = Vec3(0.1f, GRID_SIZE * 2.f, 0.1f);
-
-    m_grid_x_unit_5.resize(GRID_SIZE * 2 / GRID_UNIT_SIZE + 1);
-    for (int i = 0; i < GRID_SIZE * 2 / GRID_UNIT_SIZE + 1; i++)
+    // The grid never moves, bake every line into one draw instead of drawing ~240 cubes every frame
+    std::vector<Vertex_PCU>   gridLineVertexes;
+    std::vector<unsigned int> gridLineIndexes;
+    AddVertsForIndexedCube3D(gridLineVertexes, gridLineIndexes, Rgba8::WHITE);
+    auto addGridLine = [&](const Vec3& position, const Vec3& scale, const Rgba8& color)
     {
-        m_grid_x_unit_5[i] = new Prop(this);
-        if (i == ((GRID_SIZE * 2 / GRID_UNIT_SIZE) / 2))
-        {
-            continue;
-        }
-        AddVertsForCube3D(m_grid_x_unit_5[i]->m_vertexes, Rgba8(191, 0, 0));
-        m_grid_x_unit_5[i]->m_scale    = Vec3(GRID_SIZE * 2.f, 0.06f, 0.06f);
-        m_grid_x_unit_5[i]->m_position = Vec3(0, GRID_SIZE * 1.f - static_cast<float>(i) * 5.f, 0);
-    }
-
-    m_grid_x_unit_1.resize(GRID_SIZE * 2 + 1);
-    for (int i = 0; i < GRID_SIZE * 2 + 1; i++)
-    {
-        m_grid_x_unit_1[i] = new Prop(this);
-        if ((i % GRID_UNIT_SIZE) == 0)
-        {
-            continue;
-        }
-        AddVertsForCube3D(m_grid_x_unit_1[i]->m_vertexes, Rgba8(127, 127, 127));
-        m_grid_x_unit_1[i]->m_scale    = Vec3(GRID_SIZE * 2.f, 0.03f, 0.03f);
-        m_grid_x_unit_1[i]->m_position = Vec3(0, GRID_SIZE * 1.f - static_cast<float>(i), 0);
-    }
+        Mat44 transform = Mat44::MakeTranslation3D(position);
+        transform.Append(Mat44::MakeNonUniformScale3D(scale));
+        m_gridBatch.AddVertexes(gridLineVertexes, gridLineIndexes, transform, color);
+    };
 
-    m_grid_y_unit_5.resize(GRID_SIZE * 2 / GRID_UNIT_SIZE + 1);
+    addGridLine(Vec3(), Vec3(GRID_SIZE * 2.f, 0.1f, 0.1f), Rgba8::RED);
+    addGridLine(Vec3(), Vec3(0.1f, GRID_SIZE * 2.f, 0.1f), Rgba8::GREEN);
     for (int i = 0; i < GRID_SIZE * 2 / GRID_UNIT_SIZE + 1; i++)
     {
-        m_grid_y_unit_5[i] = new Prop(this);
         if (i == ((GRID_SIZE * 2 / GRID_UNIT_SIZE) / 2))
         {
             continue;
         }
-        AddVertsForCube3D(m_grid_y_unit_5[i]->m_vertexes, Rgba8(0, 191, 0));
-        m_grid_y_unit_5[i]->m_scale    = Vec3(0.06f, GRID_SIZE * 2.f, 0.06f);
-        m_grid_y_unit_5[i]->m_position = Vec3(GRID_SIZE * 1.f - static_cast<float>(i) * 5.f, 0, 0);
+        float offset = GRID_SIZE * 1.f - static_cast<float>(i) * 5.f;
+        addGridLine(Vec3(0, offset, 0), Vec3(GRID_SIZE * 2.f, 0.06f, 0.06f), Rgba8(191, 0, 0));
+        addGridLine(Vec3(offset, 0, 0), Vec3(0.06f, GRID_SIZE * 2.f, 0.06f), Rgba8(0, 191, 0));
     }
-
-    m_grid_y_unit_1.resize(GRID_SIZE * 2 + 1);
     for (int i = 0; i < GRID_SIZE * 2 + 1; i++)
     {
-        m_grid_y_unit_1[i] = new Prop(this);
         if ((i % GRID_UNIT_SIZE) == 0)
         {
             continue;
         }
-        AddVertsForCube3D(m_grid_y_unit_1[i]->m_vertexes, Rgba8(127, 127, 127));
-        m_grid_y_unit_1[i]->m_scale    = Vec3(0.03f, GRID_SIZE * 2.f, 0.03f);
-        m_grid_y_unit_1[i]->m_position = Vec3(GRID_SIZE * 1.f - static_cast<float>(i), 0, 0);
+        float offset = GRID_SIZE * 1.f - static_cast<float>(i);
+        addGridLine(Vec3(0, offset, 0), Vec3(GRID_SIZE * 2.f, 0.03f, 0.03f), Rgba8(127, 127, 127));
+        addGridLine(Vec3(offset, 0, 0), Vec3(0.03f, GRID_SIZE * 2.f, 0.03f), Rgba8(127, 127, 127));
     }
+    m_gridBatch.Upload();
+    GAME_LOG(LogGame, Debug, "Grid baked: %d lines, %d vertexes, %d indexes", m_gridBatch.GetSourceCount(), m_gridBatch.GetVertexCount(),
+             m_gridBatch.GetIndexCount());
     ///
 
     /// Debug Drawing
+    if (m_isHeadless)
+    {
+        // Headless instances are benchmark drivers, leave the debug render system and ImGui alone
+        return;
+    }
 
     // Arrows
     DebugAddWorldArrow(Vec3(1, 0, 0), Vec3(0, 0, 0), 0.12f, -1, Rgba8::RED, Rgba8::RED, DebugRenderMode::USE_DEPTH);
@@ -165,26 +169,30 @@ Game::Game()
     DebugAddWorldArrow(Vec3(0, 0, 1), Vec3(0, 0, 0), 0.12f, -1, Rgba8::BLUE, Rgba8::GREEN, DebugRenderMode::USE_DEPTH);
     /// 
 
+    // Debug text shares the console font
+    m_debugText.SetFont(g_theRenderDevice->CreateOrGetBitmapFont(DEBUG_TEXT_FONT_PATH), DEBUG_TEXT_FONT_ASPECT);
+
     // Text for y axis
     Mat44 transformY = Mat44::MakeTranslation3D(Vec3(0, 1.25f, 0.25f));
     transformY.AppendZRotation(180.f);
-    DebugAddWorldText("y - left", transformY, 1.f, Rgba8::GREEN, Rgba8::GREEN, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5), -1);
+    m_debugText.AddWorldText("y - left", transformY, 1.f, Rgba8::GREEN, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5));
     // Text for x axis
     Mat44 transformX = Mat44::MakeTranslation3D(Vec3(1.6f, 0, 0.25f));
     transformX.AppendZRotation(90.f);
-    DebugAddWorldText("x - forward", transformX, 1.f, Rgba8::RED, Rgba8::RED, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5), -1);
+    m_debugText.AddWorldText("x - forward", transformX, 1.f, Rgba8::RED, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5));
     // Text for z axis
     Mat44 transformZ = Mat44::MakeTranslation3D(Vec3(0, -0.25f, .9f));
     transformZ.AppendXRotation(-90.f);
     transformZ.AppendZRotation(180.f);
-    DebugAddWorldText("z - up", transformZ, 1.f, Rgba8::BLUE, Rgba8::BLUE, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5), -1);
+    m_debugText.AddWorldText("z - up", transformZ, 1.f, Rgba8::BLUE, DebugRenderMode::USE_DEPTH, Vec2(0.5, 0.5));
+    // Game state line, rewritten in place every frame
+    m_gameStateText = m_debugText.AddScreenText("", Vec2(m_screenSpace.m_mins.x, m_screenSpace.m_maxs.y), 14.f);
 
     /// Game State
     g_theInput->SetCursorMode(CursorMode::POINTER);
 
-    using enigma::core::YamlConfiguration;
-    YamlConfiguration config = YamlConfiguration::LoadFromFile(".enigma/config/engine/module.yml");
-    std::string       test   = config.GetString("moduleConfig.logger.globalLogLevel");
+    CompiledConfig config = CompiledConfig::LoadFromFile(".enigma/config/engine/module.yml");
+    std::string    test   = config.GetString("moduleConfig.logger.globalLogLevel");
 
     // Register ImGui Demo window
     using namespace enigma::core;
@@ -198,76 +206,148 @@ Game::Game()
                 ImGui::ShowDemoWindow(&m_showImGuiDemo);
             }
         });
+        imguiSub->RegisterWindow("MessageLog", [this]()
+        {
+            m_messageLogUI.Render();
+        });
+        imguiSub->RegisterWindow("Profiler", [this]()
+        {
+            m_profilerUI.Render();
+        });
+        imguiSub->RegisterWindow("Memory", [this]()
+        {
+            m_memoryUI.Render();
+        });
         LogInfo("Game", "ImGui Demo window registered - Press F1 to toggle visibility");
     }
     else
     {
         LogError("Game", "Failed to get ImGuiSubsystem - Demo window not registered");
     }
-    LogError(LogGame, "Example Error");
+    GameLogCategoryBase::SetSink(&m_messageLogUI.GetBuffer());
+    GAME_LOG(LogGame, Error, "Example Error");
 }
 
 Game::~Game()
 {
-    POINTER_SAFE_DELETE(m_grid_x)
-    POINTER_SAFE_DELETE(m_grid_y)
-    for (Prop* grid_x_unit_5 : m_grid_x_unit_5)
+    GameLogCategoryBase::SetSink(nullptr);
+    // Arena objects: run the destructors, the memory goes back with the arena's Reset()
+    g_theGameArena->Delete(m_player);
+    g_theGameArena->Delete(m_clock);
+    g_theGameArena->Delete(m_screenCamera);
+    m_player       = nullptr;
+    m_clock        = nullptr;
+    m_screenCamera = nullptr;
+    POINTER_SAFE_DELETE(m_worldCamera)
+}
+
+
+void Game::Render() const
+{
+    PROFILE_SCOPE("Game::Render");
+    if (!m_isInMainMenu)
+    {
+        m_player->Render();
+        Frustum viewFrustum = m_player->GetViewFrustum();
+        /// Grid
+        RenderGrids(viewFrustum);
+        /// Props
+        RenderProps(viewFrustum);
+        // World packets carry their own state, the queue sets only what changes between them
+        m_renderQueue.Flush(*g_theRenderDevice);
+        m_debugShapes.Render();
+        RenderWorldOverlays(*m_player->m_camera);
+    }
+
+    //======================================================================= End of World Render =======================================================================
+    RenderScreen();
+}
+
+void Game::Render(RenderSnapshot* worldSnapshot) const
+{
+    PROFILE_SCOPE("Game::Render");
+    // The world is the snapshot captured a frame or two ago; the overlays follow the live game
+    if (worldSnapshot && worldSnapshot->m_hasWorld)
     {
-        POINTER_SAFE_DELETE(grid_x_unit_5)
+        g_theRenderDevice->BeginCamera(worldSnapshot->m_worldCamera);
+        g_theRenderDevice->EndCamera(worldSnapshot->m_worldCamera);
+        worldSnapshot->m_worldQueue.Flush(*g_theRenderDevice);
+        DebugShapeBatcher::RenderBatches(worldSnapshot->m_debugShapes);
+        if (!m_isInMainMenu)
+        {
+            RenderWorldOverlays(worldSnapshot->m_worldCamera);
+        }
     }
-    for (Prop* grid_x_unit_1 : m_grid_x_unit_1)
+    RenderScreen();
+}
+
+void Game::CaptureRenderSnapshot(RenderSnapshot& snapshot) const
+{
+    PROFILE_SCOPE("Game::CaptureRenderSnapshot");
+    snapshot.m_hasWorld = !m_isInMainMenu;
+    if (!snapshot.m_hasWorld)
     {
-        POINTER_SAFE_DELETE(grid_x_unit_1)
+        return;
     }
-    for (Prop* grid_y_unit_5 : m_grid_y_unit_5)
+    snapshot.m_worldCamera = *m_player->m_camera;
+    snapshot.m_viewFrustum = m_player->GetViewFrustum();
+    m_entityRenderer.GatherInstances(m_entities, snapshot.m_meshInstances);
+    m_debugShapes.BuildBatches(snapshot.m_debugShapes);
+}
+
+void Game::PrepareRenderSnapshot(RenderSnapshot& snapshot) const
+{
+    PROFILE_SCOPE("Game::PrepareRenderSnapshot");
+    snapshot.m_worldQueue.Clear();
+    if (!snapshot.m_hasWorld)
     {
-        POINTER_SAFE_DELETE(grid_y_unit_5)
+        return;
     }
-    for (Prop* grid_y_unit_1 : m_grid_y_unit_1)
+    if (snapshot.m_viewFrustum.IsVisible(m_gridBatch.GetBounds()))
     {
-        POINTER_SAFE_DELETE(grid_y_unit_1)
+        m_gridBatch.SubmitTo(snapshot.m_worldQueue);
     }
-    POINTER_SAFE_DELETE(m_ball)
-    POINTER_SAFE_DELETE(m_cube_1)
-    POINTER_SAFE_DELETE(m_cube)
-    POINTER_SAFE_DELETE(m_player)
-    POINTER_SAFE_DELETE(m_screenCamera)
-    POINTER_SAFE_DELETE(m_worldCamera)
-    POINTER_SAFE_DELETE(m_worldCamera)
+    m_entityRenderer.SubmitInstances(snapshot.m_worldQueue, snapshot.m_meshInstances, &snapshot.m_viewFrustum);
+    snapshot.m_worldQueue.Sort();
 }
 
+void Game::ResetRenderState() const
+{
+    g_theRenderDevice->SetRasterizerMode(RasterizerMode::SOLID_CULL_BACK);
+    g_theRenderDevice->SetBlendMode(BlendMode::ALPHA);
+    g_theRenderDevice->SetSamplerMode(SamplerMode::POINT_CLAMP);
+    g_theRenderDevice->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
+}
 
-void Game::Render() const
+void Game::RenderWorldOverlays(const Camera& worldCamera) const
 {
-    g_theRenderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_BACK);
-    g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-    g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-    g_theRenderer->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
-    if (!m_isInMainMenu)
+    // The queue flush leaves the last packet's state bound, the debug passes expect the defaults
+    ResetRenderState();
+    m_debugText.RenderWorld();
+    if (!m_isHeadless)
     {
-        m_player->Render();
-        /// Grid
-        RenderGrids();
-        /// Props
-        RenderProps();
-        DebugRenderWorld(*g_theGame->m_player->m_camera);
-        DebugRenderScreen(*g_theGame->m_screenCamera);
+        DebugRenderWorld(worldCamera);
+        DebugRenderScreen(*m_screenCamera);
     }
+}
 
-    //======================================================================= End of World Render =======================================================================
+void Game::RenderScreen() const
+{
     // Second render screen camera
-    g_theRenderer->BeginCamera(*m_screenCamera);
+    g_theRenderDevice->BeginCamera(*m_screenCamera);
+    ResetRenderState();
     /// Display Only
 #ifdef COSMIC
     if (m_isInMainMenu)
     {
-        g_theRenderer->ClearScreen(g_theApp->m_backgroundColor);
-        g_theRenderer->BindTexture(nullptr);
+        g_theRenderDevice->ClearScreen(g_theApp->m_backgroundColor);
+        g_theRenderDevice->BindTexture(nullptr);
         DebugDrawRing(Vec2(800, 400), m_currentIconCircleThickness, m_currentIconCircleThickness / 10, Rgba8::WHITE);
     }
 #endif
     // UI render
-    g_theRenderer->EndCamera(*m_screenCamera);
+    m_debugText.RenderScreen();
+    g_theRenderDevice->EndCamera(*m_screenCamera);
     //======================================================================= End of Screen Render =======================================================================
     /// 
 }
@@ -278,35 +358,18 @@ void Game::UpdateCameras(float deltaTime)
     m_screenCamera->Update(deltaTime);
 }
 
-void Game::RenderGrids() const
+void Game::RenderGrids(const Frustum& viewFrustum) const
 {
-    m_grid_x->Render();
-    m_grid_y->Render();
-    for (Prop* grid_x_unit : m_grid_x_unit_5)
-    {
-        grid_x_unit->Render();
-    }
-    for (Prop* grid_x_unit : m_grid_x_unit_1)
+    if (viewFrustum.IsVisible(m_gridBatch.GetBounds()))
     {
-        grid_x_unit->Render();
-    }
-    for (Prop* grid_y_unit : m_grid_y_unit_5)
-    {
-        grid_y_unit->Render();
-    }
-    for (Prop* grid_y_unit : m_grid_y_unit_1)
-    {
-        grid_y_unit->Render();
+        m_gridBatch.SubmitTo(m_renderQueue);
     }
 }
 
-void Game::RenderProps() const
+void Game::RenderProps(const Frustum& viewFrustum) const
 {
-    g_theRenderer->BindTexture(nullptr);
-    m_cube->Render();
-    m_cube_1->Render();
-    m_ball->Render();
-    //m_testProp->Render();
+    // One sweep over the entity columns, one culled instanced draw per mesh
+    m_entityRenderer.SubmitTo(m_renderQueue, m_entities, &viewFrustum);
 }
 
 void Game::Update()
@@ -316,7 +379,11 @@ void Game::Update()
         g_theInput->SetCursorMode(CursorMode::POINTER);
     }
 
-    /// Player
+    /// Debug shapes, expire before this frame's key handlers add new ones
+    m_debugShapes.BeginFrame(m_clock->GetTotalSeconds());
+    m_debugText.BeginFrame(m_clock->GetTotalSeconds());
+
+    /// Player, a free camera on real time so it still flies while the game clock is paused
     m_player->Update(Clock::GetSystemClock().GetDeltaSeconds());
     ///
 
@@ -327,23 +394,18 @@ void Game::Update()
         static_cast<unsigned char>(brightnessFactor * 255),
         static_cast<unsigned char>(brightnessFactor * 255),
         255);
-    m_cube_1->m_color = color;
-    m_cube->m_orientation.m_rollDegrees += m_clock->GetDeltaSeconds() * 30;
-    m_cube->m_orientation.m_pitchDegrees += m_clock->GetDeltaSeconds() * 30;
-    /// 
-
-    /// Sphere
-    m_ball->m_orientation.m_yawDegrees += m_clock->GetDeltaSeconds() * 45;
+    m_entities.SetColor(m_cube_1, color);
     /// 
 
     /// Debug Only
-    std::string debugGameState = Stringf("Time: %.2f FPS: %.1f Scale: %.2f",
-                                         m_clock->GetTotalSeconds(),
-                                         m_clock->GetFrameRate(),
-                                         m_clock->GetTimeScale()
+    char debugGameState[96];
+    std::snprintf(debugGameState, sizeof(debugGameState), "Time: %.2f FPS: %.1f Scale: %.2f",
+                  m_clock->GetTotalSeconds(),
+                  m_clock->GetFrameRate(),
+                  m_clock->GetTimeScale()
     );
-    DebugAddScreenText(debugGameState, m_screenSpace, 14, 0);
-    DebugAddMessage(Stringf("Player position: %.2f, %.2f, %.2f", m_player->m_position.x, m_player->m_position.y, m_player->m_position.z), 0);
+    m_debugText.SetText(m_gameStateText, debugGameState);
+    DebugAddMessage(Stringf("Player position: %.2f, %.2f, %.2f", m_player->GetPosition().x, m_player->GetPosition().y, m_player->GetPosition().z), 0);
 
     /// Display Only
 #ifdef COSMIC
@@ -353,11 +415,6 @@ void Game::Update()
     float deltaTime = m_clock->GetDeltaSeconds();
     UpdateCameras(deltaTime);
 
-    if (m_isGameStart)
-    {
-        HandleEntityCollisions();
-    }
-
     HandleMouseEvent(deltaTime);
     HandleKeyBoardEvent(deltaTime);
 
@@ -375,8 +432,25 @@ void Game::HandleKeyBoardEvent(float deltaTime)
     if (g_theInput->WasKeyJustPressed(0x70)) // VK_F1 = 0x70
     {
         m_showImGuiDemo = !m_showImGuiDemo;
-        using namespace enigma::core;
-        LogInfo("Game", "ImGui Demo window %s", m_showImGuiDemo ? "shown" : "hidden");
+        GAME_LOG(LogGame, Info, "ImGui Demo window %s", m_showImGuiDemo ? "shown" : "hidden");
+    }
+
+    // F3 - Toggle MessageLog window
+    if (g_theInput->WasKeyJustPressed(0x72)) // VK_F3 = 0x72
+    {
+        m_messageLogUI.SetOpen(!m_messageLogUI.IsOpen());
+    }
+
+    // F4 - Toggle Profiler window
+    if (g_theInput->WasKeyJustPressed(0x73)) // VK_F4 = 0x73
+    {
+        m_profilerUI.SetOpen(!m_profilerUI.IsOpen());
+    }
+
+    // F5 - Toggle Memory window
+    if (g_theInput->WasKeyJustPressed(0x74)) // VK_F5 = 0x74
+    {
+        m_memoryUI.SetOpen(!m_memoryUI.IsOpen());
     }
 
     if (m_isInMainMenu)
@@ -406,7 +480,7 @@ void Game::HandleKeyBoardEvent(float deltaTime)
         }
         else
         {
-            g_theEventSystem->FireEvent("WindowCloseEvent");
+            g_theEventBus->Fire(WindowCloseRequestedEvent{});
         }
     }
 
@@ -414,8 +488,8 @@ void Game::HandleKeyBoardEvent(float deltaTime)
     {
         if (m_isGameStart)
         {
-            m_player->m_position    = Vec3(-2, 0, 1);
-            m_player->m_orientation = EulerAngles();
+            m_player->SetPosition(Vec3(-2, 0, 1));
+            m_player->SetOrientation(EulerAngles());
         }
     }
 
@@ -425,26 +499,25 @@ void Game::HandleKeyBoardEvent(float deltaTime)
         if (g_theInput->WasKeyJustPressed(0x31))
         {
             Vec3 forward, left, up;
-            m_player->m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
-            DebugAddWorldCylinder(m_player->m_position, m_player->m_position + forward * 20, 0.0625f, 10.f, Rgba8::YELLOW, Rgba8::YELLOW, DebugRenderMode::X_RAY);
+            m_player->GetOrientation().GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+            m_debugShapes.AddWorldCylinder(m_player->GetPosition(), m_player->GetPosition() + forward * 20, 0.0625f, 10.f, Rgba8::YELLOW, Rgba8::YELLOW, DebugRenderMode::X_RAY);
         }
         if (g_theInput->IsKeyDown(0x32))
         {
-            DebugAddWorldSphere(Vec3(m_player->m_position.x, m_player->m_position.y, 0.f), 0.25f, 10.f, Rgba8(150, 75, 0), Rgba8(150, 75, 0));
+            m_debugShapes.AddWorldSphere(Vec3(m_player->GetPosition().x, m_player->GetPosition().y, 0.f), 0.25f, 10.f, Rgba8(150, 75, 0), Rgba8(150, 75, 0));
         }
         // 3
         if (g_theInput->WasKeyJustPressed(0x33))
         {
             Vec3 forward, left, up;
-            m_player->m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+            m_player->GetOrientation().GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
             // Push the wire ball 2 unit forward away
-            DebugAddWorldWireSphere(m_player->m_position + forward * 2, 1, 5.f, Rgba8::GREEN, Rgba8::RED);
+            m_debugShapes.AddWorldWireSphere(m_player->GetPosition() + forward * 2, 1, 5.f, Rgba8::GREEN, Rgba8::RED);
         }
         // 4
         if (g_theInput->WasKeyJustPressed(0x34))
         {
-            Mat44 transform = Mat44::MakeTranslation3D(m_player->m_position);
-            transform.Append(m_player->m_orientation.GetAsMatrix_IFwd_JLeft_KUp());
+            Mat44 transform = m_player->GetModelToWorldTransform();
             DebugAddWorldBasis(transform, 20.f);
         }
 
@@ -452,10 +525,10 @@ void Game::HandleKeyBoardEvent(float deltaTime)
         if (g_theInput->WasKeyJustPressed(0x35))
         {
             Vec3 forward, left, up;
-            m_player->m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+            m_player->GetOrientation().GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
             DebugAddWorldBillboardText(
-                Stringf("Position: %.2f, %.2f, %.2f Orientation: %.2f, %.2f, %.2f", m_player->m_position.x, m_player->m_position.y, m_player->m_position.z, m_player->m_orientation.m_yawDegrees,
-                        m_player->m_orientation.m_pitchDegrees, m_player->m_orientation.m_rollDegrees), m_player->m_position + forward * 2, 0.125f, Rgba8::WHITE, Rgba8::RED,
+                Stringf("Position: %.2f, %.2f, %.2f Orientation: %.2f, %.2f, %.2f", m_player->GetPosition().x, m_player->GetPosition().y, m_player->GetPosition().z, m_player->GetOrientation().m_yawDegrees,
+                        m_player->GetOrientation().m_pitchDegrees, m_player->GetOrientation().m_rollDegrees), m_player->GetPosition() + forward * 2, 0.125f, Rgba8::WHITE, Rgba8::RED,
                 DebugRenderMode::USE_DEPTH,
                 Vec2(0.5, 0.5), 10.f);
         }
@@ -463,13 +536,19 @@ void Game::HandleKeyBoardEvent(float deltaTime)
         // 6
         if (g_theInput->WasKeyJustPressed(0x36))
         {
-            DebugAddWorldCylinder(m_player->m_position + Vec3(0, 0, 1), m_player->m_position, 0.5f, 10, Rgba8::WHITE, Rgba8::RED);
+            m_debugShapes.AddWorldCylinder(m_player->GetPosition() + Vec3(0, 0, 1), m_player->GetPosition(), 0.5f, 10, Rgba8::WHITE, Rgba8::RED);
         }
 
         // 7
         if (g_theInput->WasKeyJustPressed(0x37))
         {
-            DebugAddMessage(Stringf("Camera orientation: %.2f, %.2f, %.2f", m_player->m_orientation.m_yawDegrees, m_player->m_orientation.m_pitchDegrees, m_player->m_orientation.m_rollDegrees), 5);
+            DebugAddMessage(Stringf("Camera orientation: %.2f, %.2f, %.2f", m_player->GetOrientation().m_yawDegrees, m_player->GetOrientation().m_pitchDegrees, m_player->GetOrientation().m_rollDegrees), 5);
+        }
+
+        // 8
+        if (g_theInput->WasKeyJustPressed(0x38))
+        {
+            ToggleBall();
         }
     }
 }
@@ -489,14 +568,78 @@ void Game::StartGame()
 }
 
 
+void Game::FixedUpdate(float fixedDeltaSeconds)
+{
+    PROFILE_SCOPE("Game::FixedUpdate");
+    /// Entities, the cube and sphere spin by their angular velocities. Dense ranges are disjoint,
+    /// so integration splits across the job threads.
+    g_theJobSystem->ParallelFor(0, m_entities.GetCount(), ENTITY_UPDATE_GRAIN_SIZE, [this, fixedDeltaSeconds](size_t begin, size_t end)
+    {
+        PROFILE_SCOPE("EntityStore::IntegrateRange");
+        m_entities.IntegrateRange(begin, end, fixedDeltaSeconds);
+    });
+    /// 
+
+    if (m_isGameStart)
+    {
+        HandleEntityCollisions();
+    }
+}
+
+void Game::UpdateInterpolation(float alpha)
+{
+    PROFILE_SCOPE("Game::UpdateInterpolation");
+    g_theJobSystem->ParallelFor(0, m_entities.GetCount(), ENTITY_UPDATE_GRAIN_SIZE, [this, alpha](size_t begin, size_t end)
+    {
+        PROFILE_SCOPE("EntityStore::UpdateWorldTransformsRange");
+        m_entities.UpdateWorldTransformsRange(begin, end, alpha);
+    });
+}
+
 void Game::RenderEntities() const
 {
 }
 
 void Game::HandleEntityCollisions()
 {
+    PROFILE_SCOPE("Game::HandleEntityCollisions");
+    // Only entities that moved since last frame touch the broadphase
+    m_collisionWorld.Update(m_entities);
+    m_collisionWorld.FindContacts(m_entityContacts);
+    for (const EntityContact& contact : m_entityContacts)
+    {
+        g_theEventBus->Fire(EntityHitEvent{contact.m_entityA, contact.m_entityB});
+    }
+}
+
+EntityHandle Game::SpawnEntity(const Vec3& position, uint16_t meshId)
+{
+    EntityHandle entity = m_entities.Create(position, meshId);
+    g_theEventBus->Fire(EntitySpawnedEvent{entity, position});
+    return entity;
+}
+
+void Game::DespawnEntity(EntityHandle entity)
+{
+    m_collisionWorld.Remove(entity);
+    m_entities.Kill(entity);
+}
+
+void Game::ToggleBall()
+{
+    if (m_entities.IsAlive(m_ball))
+    {
+        DespawnEntity(m_ball);
+        return;
+    }
+    m_ball = SpawnEntity(Vec3(10, -5, 1), m_ballMesh);
+    m_entities.SetAngularVelocity(m_ball, EulerAngles(45.f, 0.f, 0.f));
+    m_collisionWorld.AddSphere(m_entities, m_ball, 2.f);
 }
 
 void Game::GarbageCollection()
 {
+    PROFILE_SCOPE("Game::GarbageCollection");
+    // Entities killed this frame leave in one compaction pass, their slots go back to the free list
+    m_entities.CollectDead();
 }
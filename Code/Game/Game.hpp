@@ -1,17 +1,28 @@
 ﻿#pragma once
 #include "GameCommon.hpp"
-#include "Engine/Core/MessageLog/MessageLogUI.hpp"
-#include "Engine/Core/LogCategory/LogCategory.hpp"
+#include "EntityStore.hpp"
 #include "Engine/Math/AABB2.hpp"
-
-// Declare game-specific log categories
-DECLARE_LOG_CATEGORY_EXTERN(LogGame);
-DECLARE_LOG_CATEGORY_EXTERN(LogPlayer);
-DECLARE_LOG_CATEGORY_EXTERN(LogAI);
+#include "Game/Framework/GameLogCategory.hpp"
+#include "Game/Collision/CollisionWorld.hpp"
+#include "Game/Collision/SpatialHashGrid.hpp"
+#include "Game/Framework/MemoryWindow.hpp"
+#include "Game/Framework/MessageLogWindow.hpp"
+#include "Game/Framework/ProfilerWindow.hpp"
+#include "Game/Render/DebugShapeBatcher.hpp"
+#include "Game/Render/DebugTextRenderer.hpp"
+#include "Game/Render/EntityMeshRenderer.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+#include "Game/Render/StaticMeshBatch.hpp"
+
+// Declare game-specific log categories (runtime default, compile-time minimum)
+DECLARE_GAME_LOG_CATEGORY_EXTERN(LogGame, Info, Verbose)
+DECLARE_GAME_LOG_CATEGORY_EXTERN(LogPlayer, Info, Verbose)
+DECLARE_GAME_LOG_CATEGORY_EXTERN(LogAI, Warning, Debug)
 
 class Player;
 class Clock;
-class Prop;
+struct Frustum;
+struct RenderSnapshot;
 
 class Game
 {
@@ -19,7 +30,20 @@ public:
     Game();
     ~Game();
     void Render() const;
+    /// Pipelined render: draws the world from a prepared snapshot (null draws none), then the
+    /// debug overlays and screen pass from the live game
+    void Render(RenderSnapshot* worldSnapshot) const;
+    /// Main thread, after the frame's simulation: copies what the world pass draws into snapshot
+    void CaptureRenderSnapshot(RenderSnapshot& snapshot) const;
+    /// Render thread: culls the snapshot and records its world packets. Reads only the snapshot
+    /// and what the game never changes once built, so it may run while the game simulates.
+    void PrepareRenderSnapshot(RenderSnapshot& snapshot) const;
+    /// Once per frame: input, cameras, debug output
     void Update();
+    /// One simulation step of fixedDeltaSeconds: entity integration, collisions
+    void FixedUpdate(float fixedDeltaSeconds);
+    /// Places moving entities alpha of the way between the last two simulation steps for rendering
+    void UpdateInterpolation(float alpha);
 
     void HandleKeyBoardEvent(float deltaTime);
     void HandleMouseEvent(float deltaTime);
@@ -30,17 +54,29 @@ public:
     void UpdateCameras(float deltaTime);
 
     // Grid
-    void RenderGrids() const;
-    void RenderProps() const;
+    void RenderGrids(const Frustum& viewFrustum) const;
+    void RenderProps(const Frustum& viewFrustum) const;
 
 private:
     void RenderEntities() const;
+    /// Default pipeline state for the passes that do not set their own (debug text, engine debug render)
+    void ResetRenderState() const;
+    void RenderWorldOverlays(const Camera& worldCamera) const;
+    void RenderScreen() const;
     void HandleEntityCollisions();
     void GarbageCollection();
 
+    /// Creates the entity and fires EntitySpawnedEvent
+    EntityHandle SpawnEntity(const Vec3& position, uint16_t meshId);
+    /// Drops the collider and kills the entity; GarbageCollection() compacts it at the end of Update
+    void         DespawnEntity(EntityHandle entity);
+    /// Spawns the ball, or despawns it when it is alive (8 key)
+    void         ToggleBall();
+
 public:
     bool m_isInMainMenu = true;
     bool m_isGameStart  = false;
+    bool m_isHeadless   = false; // Created against a headless RenderDevice, no debug render or ImGui
 
     // Camera
     Camera* m_worldCamera  = nullptr;
@@ -58,26 +94,43 @@ public:
     Player* m_player = nullptr;
     /// 
 
+    /// World entities (cubes, ball, test arrow) in SoA columns, drawn as one instanced draw per mesh
+    EntityStore        m_entities;
+    EntityMeshRenderer m_entityRenderer;
+    ///
+
+    /// Entity colliders on a uniform grid over the world rectangle, contacts refreshed each frame
+    SpatialHashGrid            m_broadphase;
+    CollisionWorld             m_collisionWorld;
+    std::vector<EntityContact> m_entityContacts;
+    ///
+
     /// Cube
-    Prop* m_cube   = nullptr;
-    Prop* m_cube_1 = nullptr;
+    EntityHandle m_cube;
+    EntityHandle m_cube_1;
     ///
 
+    /// World pass draw packets, recorded by RenderGrids/RenderProps and flushed sorted by state
+    mutable RenderCommandQueue m_renderQueue;
+
+    /// Debug shapes spawned by the number keys, merged into one draw per render mode
+    DebugShapeBatcher m_debugShapes;
+
+    /// Axis labels and the game state line, laid out once and updated in place
+    DebugTextRenderer m_debugText;
+    DebugTextHandle   m_gameStateText;
+
     /// Test Obj
-    Prop* m_testProp = nullptr;
+    EntityHandle m_testProp;
     /// 
 
     /// Balls
-    Prop* m_ball = nullptr;
+    EntityHandle m_ball;
+    uint16_t     m_ballMesh = EntityStore::NO_MESH;
     /// 
 
     /// Grid
-    Prop*              m_grid_x = nullptr;
-    Prop*              m_grid_y = nullptr;
-    std::vector<Prop*> m_grid_x_unit_5;
-    std::vector<Prop*> m_grid_x_unit_1;
-    std::vector<Prop*> m_grid_y_unit_5;
-    std::vector<Prop*> m_grid_y_unit_1;
+    StaticMeshBatch m_gridBatch; // Every grid line baked into one draw
     /// 
 
     /// ImGui Demo Window
@@ -85,7 +138,15 @@ public:
     ///
 
     /// MessageLog UI
-    enigma::core::MessageLogUI m_messageLogUI;  // MessageLog UI (~ to toggle)
+    MessageLogWindow m_messageLogUI; // Ring-buffered game and engine log view (F3 to toggle, ~ is the DevConsole)
+    ///
+
+    /// Profiler UI
+    ProfilerWindow m_profilerUI; // Last frame's scope tree and trace capture (F4 to toggle)
+    ///
+
+    /// Memory UI
+    MemoryWindow m_memoryUI; // Tagged heap usage and allocations per frame (F5 to toggle)
     ///
 
     /// Display Only
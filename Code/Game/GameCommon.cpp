@@ -1,11 +1,23 @@
 ﻿#include "GameCommon.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "Engine/Math/AABB2.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/TypedBlackboard.hpp"
+#include "Game/Render/RenderDevice.hpp"
 
 
+float GetFixedDeltaSeconds()
+{
+    return 1.f / std::max(g_gameConfig.GetValue(CONFIG_SIMULATION_TICK_RATE, 60.f), 1.f);
+}
+
 void DebugDrawRing(const Vec2& center, float radius, float thickness, const Rgba8& color)
 {
     float           halfThickness = 0.5f * thickness;
@@ -52,7 +64,7 @@ void DebugDrawRing(const Vec2& center, float radius, float thickness, const Rgba
         verts[vertIndexE].m_color    = color;
         verts[vertIndexF].m_color    = color;
     }
-    g_theRenderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+    g_theRenderDevice->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 void DebugDrawLine(const Vec2& start, const Vec2& end, float thickness, const Rgba8& color)
@@ -84,7 +96,7 @@ void DebugDrawLine(const Vec2& start, const Vec2& end, float thickness, const Rg
     tempVerts[4].m_position = Vec3(ER.x, ER.y, 0.f);
     tempVerts[5].m_position = Vec3(EL.x, EL.y, 0.f);
 
-    g_theRenderer->DrawVertexArray(6, tempVerts);
+    g_theRenderDevice->DrawVertexArray(6, tempVerts);
 }
 
 void AddVertsForCube3D(std::vector<Vertex_PCU>& verts, const Rgba8& color)
@@ -148,3 +160,137 @@ void AddVertsForCube3D(std::vector<Vertex_PCU>& verts, const Rgba8& colorX, cons
                       colorNZ
     );
 }
+
+void AddVertsForIndexedQuad3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Vec3& bottomLeft, const Vec3& bottomRight, const Vec3& topRight, const Vec3& topLeft,
+                              const Rgba8& color, const AABB2& UVs)
+{
+    unsigned int firstIndex = static_cast<unsigned int>(verts.size());
+    verts.emplace_back(bottomLeft, color, UVs.m_mins);
+    verts.emplace_back(bottomRight, color, Vec2(UVs.m_maxs.x, UVs.m_mins.y));
+    verts.emplace_back(topRight, color, UVs.m_maxs);
+    verts.emplace_back(topLeft, color, Vec2(UVs.m_mins.x, UVs.m_maxs.y));
+
+    indexes.push_back(firstIndex + 0);
+    indexes.push_back(firstIndex + 1);
+    indexes.push_back(firstIndex + 2);
+    indexes.push_back(firstIndex + 0);
+    indexes.push_back(firstIndex + 2);
+    indexes.push_back(firstIndex + 3);
+}
+
+void AddVertsForIndexedCube3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Rgba8& color)
+{
+    AddVertsForIndexedCube3D(verts, indexes, color, color, color, color, color, color);
+}
+
+void AddVertsForIndexedCube3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Rgba8& colorX, const Rgba8& colorNX, const Rgba8& colorY, const Rgba8& colorNY,
+                              const Rgba8& colorZ, const Rgba8& colorNZ)
+{
+    // Same faces and winding as AddVertsForCube3D, 24 vertexes instead of 36
+    verts.reserve(verts.size() + 24);
+    indexes.reserve(indexes.size() + 36);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(0.5, -0.5, -0.5), Vec3(0.5, 0.5, -0.5), Vec3(0.5, 0.5, 0.5), Vec3(0.5, -0.5, 0.5), colorX, AABB2::ZERO_TO_ONE);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(-0.5, 0.5, -0.5), Vec3(-0.5, -0.5, -0.5), Vec3(-0.5, -0.5, 0.5), Vec3(-0.5, 0.5, 0.5), colorNX, AABB2::ZERO_TO_ONE);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(0.5, 0.5, -0.5), Vec3(-0.5, 0.5, -0.5), Vec3(-0.5, 0.5, 0.5), Vec3(0.5, 0.5, 0.5), colorY, AABB2::ZERO_TO_ONE);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(-0.5, -0.5, -0.5), Vec3(0.5, -0.5, -0.5), Vec3(0.5, -0.5, 0.5), Vec3(-0.5, -0.5, 0.5), colorNY, AABB2::ZERO_TO_ONE);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(-0.5, 0.5, 0.5), Vec3(-0.5, -0.5, 0.5), Vec3(0.5, -0.5, 0.5), Vec3(0.5, 0.5, 0.5), colorZ, AABB2::ZERO_TO_ONE);
+    AddVertsForIndexedQuad3D(verts, indexes, Vec3(0.5, 0.5, -0.5), Vec3(0.5, -0.5, -0.5), Vec3(-0.5, -0.5, -0.5), Vec3(-0.5, 0.5, -0.5), colorNZ, AABB2::ZERO_TO_ONE);
+}
+
+void AddVertsForIndexedSphere3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Vec3& center, float radius, const Rgba8& color, const AABB2& UVs, int numSlices,
+                                int numStacks)
+{
+    // (numSlices + 1) x (numStacks + 1) grid of unique vertexes, the seam column is duplicated so
+    // it can carry u = 1. Rows are emitted bottom to top so consecutive quads share a cached row.
+    unsigned int firstIndex   = static_cast<unsigned int>(verts.size());
+    unsigned int rowLength    = static_cast<unsigned int>(numSlices + 1);
+    float        degreesSlice = 360.f / static_cast<float>(numSlices);
+    float        degreesStack = 180.f / static_cast<float>(numStacks);
+    Vec2         uvSize       = UVs.m_maxs - UVs.m_mins;
+
+    verts.reserve(verts.size() + static_cast<size_t>(numSlices + 1) * static_cast<size_t>(numStacks + 1));
+    indexes.reserve(indexes.size() + static_cast<size_t>(numSlices) * static_cast<size_t>(numStacks) * 6);
+
+    for (int stack = 0; stack <= numStacks; ++stack)
+    {
+        float latitude = -90.f + degreesStack * static_cast<float>(stack);
+        float cosLat   = CosDegrees(latitude);
+        float sinLat   = SinDegrees(latitude);
+        float v        = UVs.m_mins.y + uvSize.y * static_cast<float>(stack) / static_cast<float>(numStacks);
+        for (int slice = 0; slice <= numSlices; ++slice)
+        {
+            float longitude = degreesSlice * static_cast<float>(slice);
+            float u         = UVs.m_mins.x + uvSize.x * static_cast<float>(slice) / static_cast<float>(numSlices);
+            Vec3  position  = center + radius * Vec3(cosLat * CosDegrees(longitude), cosLat * SinDegrees(longitude), sinLat);
+            verts.emplace_back(position, color, Vec2(u, v));
+        }
+    }
+
+    for (int stack = 0; stack < numStacks; ++stack)
+    {
+        for (int slice = 0; slice < numSlices; ++slice)
+        {
+            unsigned int bottomLeft  = firstIndex + static_cast<unsigned int>(stack) * rowLength + static_cast<unsigned int>(slice);
+            unsigned int bottomRight = bottomLeft + 1;
+            unsigned int topLeft     = bottomLeft + rowLength;
+            unsigned int topRight    = topLeft + 1;
+
+            // The pole rows collapse to a point, skip the degenerate half of each quad
+            if (stack != 0)
+            {
+                indexes.push_back(bottomLeft);
+                indexes.push_back(bottomRight);
+                indexes.push_back(topRight);
+            }
+            if (stack != numStacks - 1)
+            {
+                indexes.push_back(bottomLeft);
+                indexes.push_back(topRight);
+                indexes.push_back(topLeft);
+            }
+        }
+    }
+}
+
+namespace
+{
+    struct VertexBitsHasher
+    {
+        size_t operator()(const Vertex_PCU& vertex) const
+        {
+            // FNV-1a over the raw bytes, Vertex_PCU has no padding
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&vertex);
+            uint64_t             hash  = 14695981039346656037ull;
+            for (size_t i = 0; i < sizeof(Vertex_PCU); ++i)
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    struct VertexBitsEqual
+    {
+        bool operator()(const Vertex_PCU& a, const Vertex_PCU& b) const
+        {
+            return std::memcmp(&a, &b, sizeof(Vertex_PCU)) == 0;
+        }
+    };
+}
+
+void WeldTriangleList(const std::vector<Vertex_PCU>& triangleList, std::vector<Vertex_PCU>& outVerts, std::vector<unsigned int>& outIndexes)
+{
+    std::unordered_map<Vertex_PCU, unsigned int, VertexBitsHasher, VertexBitsEqual> uniqueIndexes;
+    uniqueIndexes.reserve(triangleList.size());
+    outIndexes.reserve(outIndexes.size() + triangleList.size());
+
+    for (const Vertex_PCU& vertex : triangleList)
+    {
+        auto [found, inserted] = uniqueIndexes.try_emplace(vertex, static_cast<unsigned int>(outVerts.size()));
+        if (inserted)
+        {
+            outVerts.push_back(vertex);
+        }
+        outIndexes.push_back(found->second);
+    }
+}
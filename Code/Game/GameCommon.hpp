@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include <vector>
 
+#include "Game/Framework/StringHash.hpp"
+
 /// Whether or not enable cosmic circle (developer)
 #define COSMIC
 
@@ -12,6 +14,8 @@ namespace enigma::resource
 struct Vertex_PCU;
 struct Rgba8;
 struct Vec2;
+struct Vec3;
+struct AABB2;
 class Camera;
 class App;
 class RandomNumberGenerator;
@@ -19,6 +23,12 @@ class IRenderer;
 class InputSystem;
 class AudioSubsystem;
 class Game;
+class TypedBlackboard;
+class GameEventBus;
+class RenderDevice;
+class JobSystem;
+class GameArena;
+class Profiler;
 
 
 extern RandomNumberGenerator* g_rng;
@@ -27,6 +37,37 @@ extern IRenderer*             g_theRenderer;
 extern InputSystem*           g_theInput;
 extern AudioSubsystem*        g_theAudio;
 extern Game*                  g_theGame;
+extern TypedBlackboard        g_gameConfig;
+extern GameEventBus*          g_theEventBus;
+extern RenderDevice*          g_theRenderDevice;
+extern JobSystem*             g_theJobSystem;
+extern GameArena*             g_theGameArena;
+extern Profiler*              g_theProfiler;
+
+/// Game config keys, hashed at compile time for TypedBlackboard lookups
+constexpr HashedName CONFIG_SCREEN_SIZE_X = "screenSizeX";
+constexpr HashedName CONFIG_SCREEN_SIZE_Y = "screenSizeY";
+constexpr HashedName CONFIG_WORLD_SIZE_X  = "worldSizeX";
+constexpr HashedName CONFIG_WORLD_SIZE_Y  = "worldSizeY";
+
+constexpr HashedName CONFIG_HEADLESS_BENCHMARK_FRAMES          = "headlessBenchmarkFrames";
+constexpr HashedName CONFIG_ENTITY_STORE_BENCHMARK_ENTITIES    = "entityStoreBenchmarkEntities";
+constexpr HashedName CONFIG_JOB_THREAD_COUNT                   = "jobThreadCount";
+constexpr HashedName CONFIG_JOB_BENCHMARK_ENTITIES             = "jobBenchmarkEntities";
+constexpr HashedName CONFIG_COLLISION_BENCHMARK_ENTITIES       = "collisionBenchmarkEntities";
+constexpr HashedName CONFIG_GAME_ARENA_BENCHMARK_RESTARTS      = "gameArenaBenchmarkRestarts";
+constexpr HashedName CONFIG_RENDER_PIPELINE_BENCHMARK_ENTITIES = "renderPipelineBenchmarkEntities";
+constexpr HashedName CONFIG_SIMULATION_TICK_RATE               = "simulationTickRate";
+constexpr HashedName CONFIG_MAX_SIMULATION_STEPS               = "maxSimulationStepsPerFrame";
+constexpr HashedName CONFIG_RENDER_SNAPSHOT_COUNT              = "renderSnapshotCount";
+constexpr HashedName CONFIG_EXPORT_STARTUP_TRACE               = "exportStartupTrace";
+
+/// Seconds per FixedUpdate() step from CONFIG_SIMULATION_TICK_RATE, at least one step per second
+float GetFixedDeltaSeconds();
+
+/// Same font the engine console is configured with in module.yml
+constexpr const char* DEBUG_TEXT_FONT_PATH   = ".enigma/data/Fonts/CaiziiFixedFont";
+constexpr float       DEBUG_TEXT_FONT_ASPECT = 0.7f;
 
 constexpr float WORLD_SIZE_X   = 200.f;
 constexpr float WORLD_SIZE_Y   = 100.f;
@@ -36,6 +77,10 @@ constexpr float WORLD_CENTER_Y = WORLD_SIZE_Y / 2.f;
 constexpr float PI = 3.14159265359f;
 // Entity Data
 constexpr int MAX_ENTITY_PER_TYPE = 64;
+// Entities per job when the entity update is split across threads
+constexpr size_t ENTITY_UPDATE_GRAIN_SIZE = 4096;
+// Broadphase grid cell edge, about the size of the largest collider (the ball)
+constexpr float COLLISION_CELL_SIZE = 4.f;
 
 /// Grid
 constexpr int GRID_SIZE      = 50; // Half
@@ -49,3 +94,17 @@ void DebugDrawLine(const Vec2& start, const Vec2& end, float thickness, const Rg
 
 void AddVertsForCube3D(std::vector<Vertex_PCU>& verts, const Rgba8& color);
 void AddVertsForCube3D(std::vector<Vertex_PCU>& verts, const Rgba8& colorX, const Rgba8& colorNX, const Rgba8& colorY, const Rgba8& colorNY, const Rgba8& colorZ, const Rgba8& colorNZ);
+
+/// Indexed variants: unique vertexes plus a triangle-list index buffer, indexes are offset by the
+/// vertex count already in verts so several shapes can share one pair of arrays
+void AddVertsForIndexedQuad3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Vec3& bottomLeft, const Vec3& bottomRight, const Vec3& topRight, const Vec3& topLeft,
+                              const Rgba8& color, const AABB2& UVs);
+void AddVertsForIndexedCube3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Rgba8& color);
+void AddVertsForIndexedCube3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Rgba8& colorX, const Rgba8& colorNX, const Rgba8& colorY, const Rgba8& colorNY,
+                              const Rgba8& colorZ, const Rgba8& colorNZ);
+void AddVertsForIndexedSphere3D(std::vector<Vertex_PCU>& verts, std::vector<unsigned int>& indexes, const Vec3& center, float radius, const Rgba8& color, const AABB2& UVs, int numSlices,
+                                int numStacks);
+
+/// Collapse bitwise-identical vertexes of any unindexed triangle list (e.g. engine AddVertsFor*
+/// output) into unique vertexes plus indexes
+void WeldTriangleList(const std::vector<Vertex_PCU>& triangleList, std::vector<Vertex_PCU>& outVerts, std::vector<unsigned int>& outIndexes);
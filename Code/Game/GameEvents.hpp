@@ -0,0 +1,43 @@
+#pragma once
+#include "Game/EntityStore.hpp"
+#include "Game/Framework/StringHash.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Typed game events dispatched through g_theEventBus (see Framework/GameEventBus.hpp).
+// Each event carries its compile-time hashed ID; payload fields are plain data on the caller's stack.
+// The gameplay events are trivially copyable and small enough for QueueEvent from worker threads.
+//
+
+/// Raised by gameplay code (ESC from the menu) to ask the App to quit
+struct WindowCloseRequestedEvent
+{
+    static constexpr HashedName ID = "App.WindowCloseRequested";
+};
+
+/// Raised by Game::SpawnEntity once the entity exists in the store
+struct EntitySpawnedEvent
+{
+    static constexpr HashedName ID = "Gameplay.EntitySpawned";
+
+    EntityHandle m_entity;
+    Vec3         m_position;
+};
+
+/// Raised once per collision contact found this tick, m_target and m_instigator are the two entities
+struct EntityHitEvent
+{
+    static constexpr HashedName ID = "Gameplay.EntityHit";
+
+    EntityHandle m_target;
+    EntityHandle m_instigator;
+};
+
+/// Raised by pickup gameplay when an entity collects one
+struct PickupCollectedEvent
+{
+    static constexpr HashedName ID = "Gameplay.PickupCollected";
+
+    EntityHandle m_pickup;
+    EntityHandle m_collector;
+    int          m_value = 0;
+};
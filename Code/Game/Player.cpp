@@ -7,6 +7,8 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Game/Render/Frustum.hpp"
+#include "Game/Render/RenderDevice.hpp"
 
 Player::Player(Game* owner): Entity(owner)
 {
@@ -22,12 +24,16 @@ Player::~Player()
 
 void Player::Update(float deltaSeconds)
 {
+    // Work on copies and write them back once, so the transform is dirtied at most once a frame
+    Vec3        position    = GetPosition();
+    EulerAngles orientation = GetOrientation();
+
     Vec2 cursorDelta = g_theInput->GetCursorClientDelta();
     //printf(Stringf("%f %f \n", cursorDelta.x, cursorDelta.y).c_str());
 
 
-    m_orientation.m_yawDegrees += -cursorDelta.x * 0.125f;
-    m_orientation.m_pitchDegrees += -cursorDelta.y * 0.125f;
+    orientation.m_yawDegrees += -cursorDelta.x * 0.125f;
+    orientation.m_pitchDegrees += -cursorDelta.y * 0.125f;
 
     const XboxController& controller = g_theInput->GetController(0);
     float                 speed      = 2.0f;
@@ -41,8 +47,8 @@ void Player::Update(float deltaSeconds)
 
     if (rightStickMag > 0.f)
     {
-        m_orientation.m_yawDegrees += -(rightStickPos * speed * rightStickMag * 0.125f).x;
-        m_orientation.m_pitchDegrees += -(rightStickPos * speed * rightStickMag * 0.125f).y;
+        orientation.m_yawDegrees += -(rightStickPos * speed * rightStickMag * 0.125f).x;
+        orientation.m_pitchDegrees += -(rightStickPos * speed * rightStickMag * 0.125f).y;
     }
 
     if (g_theInput->IsKeyDown(KEYCODE_LEFT_SHIFT) || controller.IsButtonDown(XBOX_BUTTON_A))
@@ -50,70 +56,73 @@ void Player::Update(float deltaSeconds)
         speed *= 10.f;
     }
 
-    m_orientation.m_rollDegrees += leftTrigger * 0.125f * deltaSeconds * speed;
-    m_orientation.m_rollDegrees -= rightTrigger * 0.125f * deltaSeconds * speed;
+    orientation.m_rollDegrees += leftTrigger * 0.125f * deltaSeconds * speed;
+    orientation.m_rollDegrees -= rightTrigger * 0.125f * deltaSeconds * speed;
 
 
     if (g_theInput->IsKeyDown('Q'))
     {
-        m_orientation.m_rollDegrees += 0.125f;
+        orientation.m_rollDegrees += 0.125f;
     }
 
     if (g_theInput->IsKeyDown('E'))
     {
-        m_orientation.m_rollDegrees -= 0.125f;
+        orientation.m_rollDegrees -= 0.125f;
     }
 
 
-    //m_orientation.m_yawDegrees   = GetClamped(m_orientation.m_yawDegrees, -85.f, 85.f);
-    m_orientation.m_pitchDegrees = GetClamped(m_orientation.m_pitchDegrees, -85.f, 85.f);
-    m_orientation.m_rollDegrees  = GetClamped(m_orientation.m_rollDegrees, -45.f, 45.f);
+    //orientation.m_yawDegrees   = GetClamped(orientation.m_yawDegrees, -85.f, 85.f);
+    orientation.m_pitchDegrees = GetClamped(orientation.m_pitchDegrees, -85.f, 85.f);
+    orientation.m_rollDegrees  = GetClamped(orientation.m_rollDegrees, -45.f, 45.f);
 
 
     Vec3 forward, left, up;
-    m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+    orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
 
     //printf("x: %f, y: %f\n", leftStickPos.x, leftStickPos.y);
 
-    m_position += (leftStickPos * speed * leftStickMag * deltaSeconds).y * forward;
-    m_position += -(leftStickPos * speed * leftStickMag * deltaSeconds).x * left;
+    position += (leftStickPos * speed * leftStickMag * deltaSeconds).y * forward;
+    position += -(leftStickPos * speed * leftStickMag * deltaSeconds).x * left;
 
     if (g_theInput->IsKeyDown('W'))
     {
-        m_position += forward * speed * deltaSeconds;
+        position += forward * speed * deltaSeconds;
     }
 
     if (g_theInput->IsKeyDown('S'))
     {
-        m_position -= forward * speed * deltaSeconds;
+        position -= forward * speed * deltaSeconds;
     }
 
     if (g_theInput->IsKeyDown('A'))
     {
-        m_position += left * speed * deltaSeconds;
+        position += left * speed * deltaSeconds;
     }
 
     if (g_theInput->IsKeyDown('D'))
     {
-        m_position -= left * speed * deltaSeconds;
+        position -= left * speed * deltaSeconds;
     }
 
     if (g_theInput->IsKeyDown('Z') || controller.IsButtonDown(XBOX_BUTTON_RS))
     {
-        m_position.z -= deltaSeconds * speed;
+        position.z -= deltaSeconds * speed;
     }
 
     if (g_theInput->IsKeyDown('C') || controller.IsButtonDown(XBOX_BUTTON_LS))
     {
-        m_position.z += deltaSeconds * speed;
+        position.z += deltaSeconds * speed;
     }
 
-    m_camera->SetPerspectiveView(2.0f, 60.f, 0.1f, 100.f);
+    SetPosition(position);
+    SetOrientation(orientation);
+
+    m_camera->SetPerspectiveView(CAMERA_ASPECT, CAMERA_FOV_DEGREES, CAMERA_NEAR_DISTANCE, CAMERA_FAR_DISTANCE);
     Mat44 ndcMatrix;
     ndcMatrix.SetIJK3D(Vec3(0, 0, 1), Vec3(-1, 0, 0), Vec3(0, 1, 0));
 
-    m_camera->SetPosition(m_position);
-    m_camera->SetOrientation(m_orientation);
+    m_camera->SetPosition(position);
+    m_camera->SetOrientation(orientation);
 
 
     m_camera->SetCameraToRenderTransform(ndcMatrix);
@@ -121,8 +130,13 @@ void Player::Update(float deltaSeconds)
     Entity::Update(deltaSeconds);
 }
 
+Frustum Player::GetViewFrustum() const
+{
+    return Frustum::MakePerspective(GetPosition(), GetOrientation(), CAMERA_ASPECT, CAMERA_FOV_DEGREES, CAMERA_NEAR_DISTANCE, CAMERA_FAR_DISTANCE);
+}
+
 void Player::Render() const
 {
-    g_theRenderer->BeginCamera(*m_camera);
-    g_theRenderer->EndCamera(*m_camera);
+    g_theRenderDevice->BeginCamera(*m_camera);
+    g_theRenderDevice->EndCamera(*m_camera);
 }
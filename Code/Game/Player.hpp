@@ -2,6 +2,7 @@
 #include "Entity.hpp"
 
 class Camera;
+struct Frustum;
 
 class Player : public Entity
 {
@@ -9,8 +10,16 @@ public:
     Player(Game* owner);
     ~Player() override;
 
+    static constexpr float CAMERA_ASPECT        = 2.0f;
+    static constexpr float CAMERA_FOV_DEGREES   = 60.f;
+    static constexpr float CAMERA_NEAR_DISTANCE = 0.1f;
+    static constexpr float CAMERA_FAR_DISTANCE  = 100.f;
+
     Camera* m_camera = nullptr;
 
+    /// World-space view volume of m_camera as of the last Update()
+    Frustum GetViewFrustum() const;
+
     void Update(float deltaSeconds) override;
     void Render() const override;
 };
@@ -3,6 +3,8 @@
 #include "GameCommon.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+#include "Game/Render/RenderDevice.hpp"
 
 Prop::Prop(Game* game) : Entity(game)
 {
@@ -10,20 +12,76 @@ Prop::Prop(Game* game) : Entity(game)
 
 Prop::~Prop()
 {
+    ReleaseStaticMesh();
 }
 
 void Prop::Update(float deltaSeconds)
 {
     Entity::Update(deltaSeconds);
-    m_orientation = m_orientation + m_angularVelocity * deltaSeconds;
+    SetOrientation(GetOrientation() + m_angularVelocity * deltaSeconds);
 }
 
 void Prop::Render() const
 {
-    g_theRenderer->SetModelConstants(GetModelToWorldTransform(), m_color);
-    //g_theRenderer->SetSamplerMode(SamplerMode::BILINEAR_WRAP);
-    g_theRenderer->SetBlendMode(BlendMode::OPAQUE);
-    //g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-    g_theRenderer->BindTexture(m_texture);
-    g_theRenderer->DrawVertexArray(m_vertexes);
+    g_theRenderDevice->SetModelConstants(GetModelToWorldTransform(), m_color);
+    //g_theRenderDevice->SetSamplerMode(SamplerMode::BILINEAR_WRAP);
+    g_theRenderDevice->SetBlendMode(BlendMode::OPAQUE);
+    //g_theRenderDevice->SetBlendMode(BlendMode::ALPHA);
+    g_theRenderDevice->BindTexture(m_texture);
+    if (m_mesh.IsValid())
+    {
+        g_theRenderDevice->DrawMesh(m_mesh);
+    }
+    else if (!m_indexes.empty())
+    {
+        g_theRenderDevice->DrawIndexedVertexArray(m_vertexes, m_indexes);
+    }
+    else
+    {
+        g_theRenderDevice->DrawVertexArray(m_vertexes);
+    }
+}
+
+void Prop::SubmitTo(RenderCommandQueue& queue) const
+{
+    RenderPacketState state;
+    state.m_blendMode = BlendMode::OPAQUE;
+    state.m_texture   = m_texture;
+    if (m_mesh.IsValid())
+    {
+        queue.DrawMesh(state, GetModelToWorldTransform(), m_color, m_mesh);
+    }
+    else if (!m_indexes.empty())
+    {
+        queue.DrawIndexedVertexArray(state, GetModelToWorldTransform(), m_color, m_vertexes, m_indexes);
+    }
+    else
+    {
+        queue.DrawVertexArray(state, GetModelToWorldTransform(), m_color, m_vertexes);
+    }
+}
+
+void Prop::UploadStaticMesh()
+{
+    ReleaseStaticMesh();
+    m_mesh = g_theRenderDevice->CreateMesh(m_vertexes, m_indexes);
+    ComputeLocalBounds();
+}
+
+void Prop::ComputeLocalBounds()
+{
+    m_localBounds = ComputeBoundingVolume(m_vertexes);
+}
+
+BoundingVolume Prop::GetWorldBounds() const
+{
+    return TransformBoundingVolume(m_localBounds, GetModelToWorldTransform());
+}
+
+void Prop::ReleaseStaticMesh()
+{
+    if (m_mesh.IsValid())
+    {
+        g_theRenderDevice->DestroyMesh(m_mesh);
+    }
 }
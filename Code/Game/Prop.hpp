@@ -4,6 +4,10 @@
 #include "Entity.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Renderer/Texture.hpp"
+#include "Game/Render/BoundingVolume.hpp"
+#include "Game/Render/MeshHandle.hpp"
+
+class RenderCommandQueue;
 
 class Prop : public Entity
 {
@@ -13,8 +17,22 @@ public:
 
     void Update(float deltaSeconds) override;
     void Render() const override;
+    void SubmitTo(RenderCommandQueue& queue) const;
+
+    /// Upload m_vertexes (and m_indexes, if any) once into immutable buffers, Render() then draws by handle with no
+    /// per-frame upload. Call again after editing m_vertexes.
+    void UploadStaticMesh();
+    void ReleaseStaticMesh();
+
+    /// Fit m_localBounds to m_vertexes. UploadStaticMesh() does this; call it directly for props drawn
+    /// from m_vertexes after editing them.
+    void           ComputeLocalBounds();
+    BoundingVolume GetWorldBounds() const;
 
-    std::vector<Vertex_PCU> m_vertexes;
-    Rgba8                   m_color   = Rgba8::WHITE;
-    Texture*                m_texture = nullptr;
+    std::vector<Vertex_PCU>   m_vertexes;
+    std::vector<unsigned int> m_indexes; // Empty for a plain triangle list
+    Rgba8                     m_color   = Rgba8::WHITE;
+    Texture*                  m_texture = nullptr;
+    MeshHandle                m_mesh;
+    BoundingVolume            m_localBounds; // Empty until computed, empty bounds are never culled
 };
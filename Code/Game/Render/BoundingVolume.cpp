@@ -0,0 +1,61 @@
+#include "BoundingVolume.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Mat44.hpp"
+
+BoundingVolume ComputeBoundingVolume(const std::vector<Vertex_PCU>& vertexes)
+{
+    BoundingVolume bounds;
+    if (vertexes.empty())
+    {
+        return bounds;
+    }
+
+    Vec3 mins = vertexes[0].m_position;
+    Vec3 maxs = vertexes[0].m_position;
+    for (const Vertex_PCU& vertex : vertexes)
+    {
+        mins.x = std::min(mins.x, vertex.m_position.x);
+        mins.y = std::min(mins.y, vertex.m_position.y);
+        mins.z = std::min(mins.z, vertex.m_position.z);
+        maxs.x = std::max(maxs.x, vertex.m_position.x);
+        maxs.y = std::max(maxs.y, vertex.m_position.y);
+        maxs.z = std::max(maxs.z, vertex.m_position.z);
+    }
+    bounds.m_center      = Vec3((mins.x + maxs.x) * 0.5f, (mins.y + maxs.y) * 0.5f, (mins.z + maxs.z) * 0.5f);
+    bounds.m_halfExtents = Vec3((maxs.x - mins.x) * 0.5f, (maxs.y - mins.y) * 0.5f, (maxs.z - mins.z) * 0.5f);
+
+    float radiusSquared = 0.f;
+    for (const Vertex_PCU& vertex : vertexes)
+    {
+        Vec3 offset   = vertex.m_position - bounds.m_center;
+        radiusSquared = std::max(radiusSquared, offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+    }
+    bounds.m_radius = std::sqrt(radiusSquared);
+    return bounds;
+}
+
+BoundingVolume TransformBoundingVolume(const BoundingVolume& localBounds, const Mat44& transform)
+{
+    if (localBounds.IsEmpty())
+    {
+        return localBounds;
+    }
+
+    Vec3 iBasis = transform.GetIBasis3D();
+    Vec3 jBasis = transform.GetJBasis3D();
+    Vec3 kBasis = transform.GetKBasis3D();
+    Vec3 extent = localBounds.m_halfExtents;
+
+    BoundingVolume worldBounds;
+    worldBounds.m_center      = transform.TransformPosition3D(localBounds.m_center);
+    worldBounds.m_halfExtents = Vec3(std::fabs(iBasis.x) * extent.x + std::fabs(jBasis.x) * extent.y + std::fabs(kBasis.x) * extent.z,
+                                     std::fabs(iBasis.y) * extent.x + std::fabs(jBasis.y) * extent.y + std::fabs(kBasis.y) * extent.z,
+                                     std::fabs(iBasis.z) * extent.x + std::fabs(jBasis.z) * extent.y + std::fabs(kBasis.z) * extent.z);
+    float maxScale       = std::max(iBasis.GetLength(), std::max(jBasis.GetLength(), kBasis.GetLength()));
+    worldBounds.m_radius = localBounds.m_radius * maxScale;
+    return worldBounds;
+}
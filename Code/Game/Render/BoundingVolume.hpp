@@ -0,0 +1,28 @@
+#pragma once
+#include <vector>
+
+#include "Engine/Math/Vec3.hpp"
+
+struct Mat44;
+struct Vertex_PCU;
+
+//-----------------------------------------------------------------------------------------------
+// Bounds for culling: a box and a sphere sharing one center. The sphere is the tightest one
+// centered on the box (not the minimal sphere), so both move together under a transform and a
+// culling test can use whichever is tighter against each plane.
+//
+struct BoundingVolume
+{
+    Vec3  m_center;
+    Vec3  m_halfExtents;
+    float m_radius = -1.f; // Negative means empty, nothing to cull against
+
+    bool IsEmpty() const { return m_radius < 0.f; }
+};
+
+/// Box and sphere around a vertex array, in the vertexes' own space
+BoundingVolume ComputeBoundingVolume(const std::vector<Vertex_PCU>& vertexes);
+
+/// Conservative bounds after transform: the box is re-fit around the rotated box, the sphere
+/// radius is scaled by the largest axis scale
+BoundingVolume TransformBoundingVolume(const BoundingVolume& localBounds, const Mat44& transform);
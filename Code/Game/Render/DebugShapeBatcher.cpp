@@ -0,0 +1,254 @@
+#include "DebugShapeBatcher.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Render/RenderDevice.hpp"
+#include "Game/Render/VertexBaking.hpp"
+
+namespace
+{
+    unsigned char LerpColorChannel(unsigned char start, unsigned char end, float fraction)
+    {
+        return static_cast<unsigned char>(static_cast<float>(start) + (static_cast<float>(end) - static_cast<float>(start)) * fraction + 0.5f);
+    }
+}
+
+void DebugShapeBatcher::AddWorldCylinder(const Vec3& base, const Vec3& top, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode)
+{
+    uint32_t shapeIndex = AllocateShape(duration, startColor, endColor, mode, false);
+    Shape&   shape      = m_shapes[shapeIndex];
+    AddVertsForCylinder3D(shape.m_vertexes, base, top, radius);
+    for (size_t i = 0; i < shape.m_vertexes.size(); ++i)
+    {
+        shape.m_indexes.push_back(static_cast<unsigned int>(i));
+    }
+    CommitShape(shapeIndex);
+}
+
+void DebugShapeBatcher::AddWorldSphere(const Vec3& center, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode)
+{
+    uint32_t shapeIndex = AllocateShape(duration, startColor, endColor, mode, false);
+    Shape&   shape      = m_shapes[shapeIndex];
+    AddVertsForIndexedSphere3D(shape.m_vertexes, shape.m_indexes, center, radius, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    CommitShape(shapeIndex);
+}
+
+void DebugShapeBatcher::AddWorldWireSphere(const Vec3& center, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode)
+{
+    uint32_t shapeIndex = AllocateShape(duration, startColor, endColor, mode, true);
+    Shape&   shape      = m_shapes[shapeIndex];
+    AddVertsForIndexedSphere3D(shape.m_vertexes, shape.m_indexes, center, radius, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    CommitShape(shapeIndex);
+}
+
+void DebugShapeBatcher::BeginFrame(double currentSeconds)
+{
+    m_currentSeconds = currentSeconds;
+
+    for (uint32_t shapeIndex : m_frameShapes)
+    {
+        ReleaseShape(shapeIndex);
+    }
+    m_frameShapes.clear();
+
+    // Visit only buckets whose tick is fully in the past; anything filed there for this wheel
+    // turn has expired. A gap longer than one turn visits every bucket once.
+    int64_t lastTick  = GetTick(currentSeconds) - 1;
+    int64_t firstTick = std::max(m_lastProcessedTick + 1, lastTick - WHEEL_BUCKET_COUNT + 1);
+    for (int64_t tick = firstTick; tick <= lastTick; ++tick)
+    {
+        std::vector<uint32_t>& bucket    = m_wheel[tick % WHEEL_BUCKET_COUNT];
+        size_t                 keepCount = 0;
+        for (uint32_t shapeIndex : bucket)
+        {
+            if (GetTick(m_shapes[shapeIndex].m_expirySeconds) <= tick)
+            {
+                ReleaseShape(shapeIndex);
+            }
+            else
+            {
+                bucket[keepCount++] = shapeIndex; // A later wheel turn
+            }
+        }
+        bucket.resize(keepCount);
+    }
+    m_lastProcessedTick = std::max(m_lastProcessedTick, lastTick);
+}
+
+void DebugShapeBatcher::Render() const
+{
+    if (m_liveShapes.empty())
+    {
+        return;
+    }
+    BuildBatches(m_batches);
+    RenderBatches(m_batches);
+}
+
+void DebugShapeBatcher::BuildBatches(Batches& outBatches) const
+{
+    for (Batch& batch : outBatches)
+    {
+        batch.m_vertexes.clear();
+        batch.m_indexes.clear();
+    }
+
+    for (uint32_t shapeIndex : m_liveShapes)
+    {
+        const Shape& shape    = m_shapes[shapeIndex];
+        float        fraction = 0.f;
+        if (shape.m_duration > 0.f)
+        {
+            fraction = static_cast<float>((m_currentSeconds - shape.m_startSeconds) / static_cast<double>(shape.m_duration));
+            fraction = std::min(std::max(fraction, 0.f), 1.f);
+        }
+        Rgba8 tint(LerpColorChannel(shape.m_startColor.r, shape.m_endColor.r, fraction),
+                   LerpColorChannel(shape.m_startColor.g, shape.m_endColor.g, fraction),
+                   LerpColorChannel(shape.m_startColor.b, shape.m_endColor.b, fraction),
+                   LerpColorChannel(shape.m_startColor.a, shape.m_endColor.a, fraction));
+
+        Batch&       batch     = outBatches[GetBatchIndex(shape.m_mode, shape.m_isWireframe)];
+        unsigned int baseIndex = static_cast<unsigned int>(batch.m_vertexes.size());
+        for (const Vertex_PCU& vertex : shape.m_vertexes)
+        {
+            Vertex_PCU tinted = vertex;
+            tinted.m_color.r  = MultiplyColorChannel(vertex.m_color.r, tint.r);
+            tinted.m_color.g  = MultiplyColorChannel(vertex.m_color.g, tint.g);
+            tinted.m_color.b  = MultiplyColorChannel(vertex.m_color.b, tint.b);
+            tinted.m_color.a  = MultiplyColorChannel(vertex.m_color.a, tint.a);
+            batch.m_vertexes.push_back(tinted);
+        }
+        for (unsigned int index : shape.m_indexes)
+        {
+            batch.m_indexes.push_back(baseIndex + index);
+        }
+    }
+}
+
+void DebugShapeBatcher::RenderBatches(const Batches& batches)
+{
+    for (DebugRenderMode mode : {DebugRenderMode::USE_DEPTH, DebugRenderMode::ALWAYS, DebugRenderMode::X_RAY})
+    {
+        for (bool isWireframe : {false, true})
+        {
+            const Batch& batch = batches[GetBatchIndex(mode, isWireframe)];
+            if (batch.m_indexes.empty())
+            {
+                continue;
+            }
+
+            g_theRenderDevice->SetBlendMode(BlendMode::ALPHA);
+            g_theRenderDevice->SetSamplerMode(SamplerMode::POINT_CLAMP);
+            g_theRenderDevice->BindTexture(nullptr);
+            g_theRenderDevice->SetRasterizerMode(isWireframe ? RasterizerMode::WIREFRAME_CULL_NONE : RasterizerMode::SOLID_CULL_BACK);
+            if (mode == DebugRenderMode::X_RAY)
+            {
+                // Faded pass through occluders, then the regular depth-tested pass on top
+                g_theRenderDevice->SetDepthMode(DepthMode::READ_ONLY_ALWAYS);
+                g_theRenderDevice->SetModelConstants(Mat44(), Rgba8(255, 255, 255, 64));
+                g_theRenderDevice->DrawIndexedVertexArray(batch.m_vertexes, batch.m_indexes);
+            }
+            g_theRenderDevice->SetDepthMode(mode == DebugRenderMode::ALWAYS ? DepthMode::READ_ONLY_ALWAYS : DepthMode::READ_WRITE_LESS_EQUAL);
+            g_theRenderDevice->SetModelConstants();
+            g_theRenderDevice->DrawIndexedVertexArray(batch.m_vertexes, batch.m_indexes);
+        }
+    }
+}
+
+void DebugShapeBatcher::Clear()
+{
+    while (!m_liveShapes.empty())
+    {
+        ReleaseShape(m_liveShapes.back());
+    }
+    m_frameShapes.clear();
+    for (std::vector<uint32_t>& bucket : m_wheel)
+    {
+        bucket.clear();
+    }
+}
+
+uint32_t DebugShapeBatcher::AllocateShape(float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode, bool isWireframe)
+{
+    uint32_t shapeIndex;
+    if (!m_freeShapes.empty())
+    {
+        shapeIndex = m_freeShapes.back();
+        m_freeShapes.pop_back();
+    }
+    else
+    {
+        shapeIndex = static_cast<uint32_t>(m_shapes.size());
+        m_shapes.emplace_back();
+    }
+
+    Shape& shape         = m_shapes[shapeIndex];
+    shape.m_startColor   = startColor;
+    shape.m_endColor     = endColor;
+    shape.m_startSeconds = m_currentSeconds;
+    shape.m_duration     = duration;
+    shape.m_mode         = mode;
+    shape.m_isWireframe  = isWireframe;
+    return shapeIndex;
+}
+
+void DebugShapeBatcher::CommitShape(uint32_t shapeIndex)
+{
+    Shape& shape      = m_shapes[shapeIndex];
+    shape.m_liveIndex = static_cast<uint32_t>(m_liveShapes.size());
+    m_liveShapes.push_back(shapeIndex);
+
+    if (shape.m_duration == 0.f)
+    {
+        m_frameShapes.push_back(shapeIndex);
+    }
+    else if (shape.m_duration > 0.f)
+    {
+        shape.m_expirySeconds = m_currentSeconds + static_cast<double>(shape.m_duration);
+        m_wheel[GetTick(shape.m_expirySeconds) % WHEEL_BUCKET_COUNT].push_back(shapeIndex);
+    }
+}
+
+void DebugShapeBatcher::ReleaseShape(uint32_t shapeIndex)
+{
+    Shape&   shape     = m_shapes[shapeIndex];
+    uint32_t liveIndex = shape.m_liveIndex;
+    uint32_t lastShape = m_liveShapes.back();
+
+    m_liveShapes[liveIndex]         = lastShape;
+    m_shapes[lastShape].m_liveIndex = liveIndex;
+    m_liveShapes.pop_back();
+
+    shape.m_liveIndex = INVALID_SLOT;
+    shape.m_vertexes.clear(); // Capacity is kept for the next shape that reuses this record
+    shape.m_indexes.clear();
+    m_freeShapes.push_back(shapeIndex);
+}
+
+int64_t DebugShapeBatcher::GetTick(double seconds) const
+{
+    return static_cast<int64_t>(seconds / WHEEL_BUCKET_SECONDS);
+}
+
+int DebugShapeBatcher::GetBatchIndex(DebugRenderMode mode, bool isWireframe)
+{
+    int modeIndex = 0;
+    switch (mode)
+    {
+    case DebugRenderMode::USE_DEPTH:
+        modeIndex = 0;
+        break;
+    case DebugRenderMode::ALWAYS:
+        modeIndex = 1;
+        break;
+    case DebugRenderMode::X_RAY:
+        modeIndex = 2;
+        break;
+    }
+    return modeIndex * 2 + (isWireframe ? 1 : 0);
+}
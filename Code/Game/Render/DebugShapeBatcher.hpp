@@ -0,0 +1,95 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Renderer/DebugRenderSystem.hpp"
+
+class RenderDevice;
+
+//-----------------------------------------------------------------------------------------------
+// Game-side debug shapes drawn in merged batches. Each shape is tessellated once when added and
+// kept in a pooled record (recycled records keep their vertex capacity). Every frame the live
+// shapes are appended into one indexed vertex array per (render mode, solid/wire) pair, so all
+// debug geometry costs at most six draws however many shapes are alive.
+//
+// Expiry runs on a hashed timing wheel: a shape is filed in the bucket of its expiry tick, and
+// BeginFrame only visits the buckets whose ticks have passed, so the cost is proportional to the
+// shapes expiring (plus any sharing their bucket a full wheel turn later), not to every live
+// shape. Shapes may outlive their duration by up to one bucket width.
+//
+// Durations follow the engine's debug render convention: 0 draws for one frame, negative lives
+// until Clear().
+//
+// Render() is BuildBatches() followed by RenderBatches(); a RenderSnapshot keeps the built batches
+// so they can be drawn a frame later, after the shapes themselves have moved on.
+//
+class DebugShapeBatcher
+{
+public:
+    static constexpr int    WHEEL_BUCKET_COUNT   = 256;
+    static constexpr double WHEEL_BUCKET_SECONDS = 0.125;
+    static constexpr int    BATCH_COUNT          = 6; // One merged array per render mode and fill
+    static constexpr int    SPHERE_SLICES        = 16;
+    static constexpr int    SPHERE_STACKS        = 8;
+
+    struct Batch
+    {
+        std::vector<Vertex_PCU>   m_vertexes;
+        std::vector<unsigned int> m_indexes;
+    };
+
+    using Batches = Batch[BATCH_COUNT];
+
+    void AddWorldCylinder(const Vec3& base, const Vec3& top, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor,
+                          DebugRenderMode mode = DebugRenderMode::USE_DEPTH);
+    void AddWorldSphere(const Vec3& center, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode = DebugRenderMode::USE_DEPTH);
+    void AddWorldWireSphere(const Vec3& center, float radius, float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode = DebugRenderMode::USE_DEPTH);
+
+    /// Expires shapes whose lifetime ended before currentSeconds, then stamps the new frame time
+    void BeginFrame(double currentSeconds);
+    void Render() const;
+    /// Merges every live shape, tinted for the current time, into outBatches
+    void        BuildBatches(Batches& outBatches) const;
+    static void RenderBatches(const Batches& batches);
+    void Clear();
+    /// Which of the BATCH_COUNT merged arrays a shape of this mode and fill is appended to
+    static int GetBatchIndex(DebugRenderMode mode, bool isWireframe);
+
+    int GetLiveShapeCount() const { return static_cast<int>(m_liveShapes.size()); }
+    int GetPooledShapeCount() const { return static_cast<int>(m_shapes.size()); }
+
+private:
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+    struct Shape
+    {
+        std::vector<Vertex_PCU>   m_vertexes; // World space, white, tinted at render time
+        std::vector<unsigned int> m_indexes;
+        Rgba8                     m_startColor;
+        Rgba8                     m_endColor;
+        double                    m_startSeconds  = 0.0;
+        double                    m_expirySeconds = 0.0;
+        float                     m_duration      = 0.f;
+        DebugRenderMode           m_mode          = DebugRenderMode::USE_DEPTH;
+        bool                      m_isWireframe   = false;
+        uint32_t                  m_liveIndex     = INVALID_SLOT;
+    };
+
+    uint32_t AllocateShape(float duration, const Rgba8& startColor, const Rgba8& endColor, DebugRenderMode mode, bool isWireframe);
+    void     CommitShape(uint32_t shapeIndex);
+    void     ReleaseShape(uint32_t shapeIndex);
+    int64_t  GetTick(double seconds) const;
+
+    std::vector<Shape>    m_shapes;     // Pool, never shrinks
+    std::vector<uint32_t> m_freeShapes;
+    std::vector<uint32_t> m_liveShapes; // Dense list of live shape indexes, swap-removed
+    std::vector<uint32_t> m_frameShapes; // Zero-duration shapes, released at the next BeginFrame
+    std::vector<uint32_t> m_wheel[WHEEL_BUCKET_COUNT];
+    int64_t               m_lastProcessedTick = -1;
+    double                m_currentSeconds    = 0.0;
+
+    mutable Batches m_batches;
+};
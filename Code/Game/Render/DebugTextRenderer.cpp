@@ -0,0 +1,365 @@
+#include "DebugTextRenderer.hpp"
+
+#include <cstring>
+
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Render/RenderDevice.hpp"
+
+namespace
+{
+    uint64_t MixHash(uint64_t hash, uint64_t value)
+    {
+        return hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+    }
+
+    uint64_t FloatBits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+bool DebugTextRenderer::LayoutKey::Matches(std::string_view text, const BitmapFont* font, float cellHeight, const Vec2& alignment, bool isWorld) const
+{
+    return m_font == font && m_cellHeight == cellHeight && m_alignment.x == alignment.x && m_alignment.y == alignment.y && m_isWorld == isWorld && m_text == text;
+}
+
+void DebugTextRenderer::SetFont(BitmapFont* font, float cellAspect)
+{
+    Clear();
+    m_layouts.clear();
+    m_font       = font;
+    m_cellAspect = cellAspect;
+}
+
+DebugTextHandle DebugTextRenderer::AddWorldText(std::string_view text, const Mat44& transform, float textHeight, const Rgba8& color, DebugRenderMode mode, const Vec2& alignment,
+                                                float duration)
+{
+    return AddEntry(text, transform, textHeight, color, mode, alignment, true, duration);
+}
+
+DebugTextHandle DebugTextRenderer::AddScreenText(std::string_view text, const Vec2& position, float cellHeight, const Rgba8& color, const Vec2& alignment, float duration)
+{
+    return AddEntry(text, Mat44::MakeTranslation3D(Vec3(position.x, position.y, 0.f)), cellHeight, color, DebugRenderMode::ALWAYS, alignment, false, duration);
+}
+
+void DebugTextRenderer::SetText(DebugTextHandle handle, std::string_view text)
+{
+    Entry* entry = GetEntry(handle);
+    if (!entry)
+    {
+        return;
+    }
+
+    uint64_t oldLayoutId = entry->m_layoutId;
+    Layout&  oldLayout   = m_layouts.at(oldLayoutId);
+    if (oldLayout.m_key.m_text == text)
+    {
+        return;
+    }
+
+    bool     found       = false;
+    uint64_t newLayoutId = FindLayoutSlot(text, entry->m_cellHeight, entry->m_alignment, entry->m_isWorld, found);
+    if (found)
+    {
+        ++m_layouts.at(newLayoutId).m_refCount;
+        ReleaseLayout(oldLayoutId);
+    }
+    else if (oldLayout.m_refCount == 1)
+    {
+        // Sole owner of the old text, e.g. a per-frame counter: rebuild into the same node
+        auto node  = m_layouts.extract(oldLayoutId);
+        node.key() = newLayoutId;
+        node.mapped().m_key.m_text.assign(text.data(), text.size());
+        BuildLayout(node.mapped());
+        m_layouts.insert(std::move(node));
+    }
+    else
+    {
+        ReleaseLayout(oldLayoutId);
+        newLayoutId = AcquireLayout(text, entry->m_cellHeight, entry->m_alignment, entry->m_isWorld);
+    }
+    entry->m_layoutId = newLayoutId;
+}
+
+void DebugTextRenderer::SetColor(DebugTextHandle handle, const Rgba8& color)
+{
+    if (Entry* entry = GetEntry(handle))
+    {
+        entry->m_color = color;
+    }
+}
+
+void DebugTextRenderer::SetWorldTransform(DebugTextHandle handle, const Mat44& transform)
+{
+    Entry* entry = GetEntry(handle);
+    if (entry && entry->m_isWorld)
+    {
+        entry->m_transform = transform;
+    }
+}
+
+void DebugTextRenderer::SetScreenPosition(DebugTextHandle handle, const Vec2& position)
+{
+    Entry* entry = GetEntry(handle);
+    if (entry && !entry->m_isWorld)
+    {
+        entry->m_transform = Mat44::MakeTranslation3D(Vec3(position.x, position.y, 0.f));
+    }
+}
+
+void DebugTextRenderer::Remove(DebugTextHandle& handle)
+{
+    if (GetEntry(handle))
+    {
+        ReleaseEntry(handle.m_index);
+    }
+    handle = DebugTextHandle();
+}
+
+bool DebugTextRenderer::IsValid(DebugTextHandle handle) const
+{
+    return handle.IsValid() && handle.m_index < m_entries.size() && m_entries[handle.m_index].m_generation == handle.m_generation &&
+        m_entries[handle.m_index].m_liveIndex != DebugTextHandle::INVALID_INDEX;
+}
+
+void DebugTextRenderer::BeginFrame(double currentSeconds)
+{
+    m_currentSeconds = currentSeconds;
+    ++m_frameNumber;
+
+    for (size_t i = 0; i < m_liveEntries.size();)
+    {
+        const Entry& entry = m_entries[m_liveEntries[i]];
+        if (entry.m_expirySeconds >= 0.0 && entry.m_expirySeconds <= currentSeconds)
+        {
+            ReleaseEntry(m_liveEntries[i]); // Swaps the last live entry into i
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    if (m_frameNumber % LAYOUT_EVICTION_FRAMES == 0)
+    {
+        for (auto it = m_layouts.begin(); it != m_layouts.end();)
+        {
+            const Layout& layout = it->second;
+            if (layout.m_refCount == 0 && m_frameNumber - layout.m_lastUsedFrame >= LAYOUT_EVICTION_FRAMES)
+            {
+                it = m_layouts.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+void DebugTextRenderer::RenderWorld() const
+{
+    if (!m_font || m_liveEntries.empty())
+    {
+        return;
+    }
+
+    g_theRenderDevice->SetBlendMode(BlendMode::ALPHA);
+    g_theRenderDevice->SetSamplerMode(SamplerMode::POINT_CLAMP);
+    g_theRenderDevice->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
+    g_theRenderDevice->BindTexture(&m_font->GetTexture());
+
+    for (DebugRenderMode mode : {DebugRenderMode::USE_DEPTH, DebugRenderMode::ALWAYS, DebugRenderMode::X_RAY})
+    {
+        g_theRenderDevice->SetDepthMode(mode == DebugRenderMode::USE_DEPTH ? DepthMode::READ_WRITE_LESS_EQUAL : DepthMode::READ_ONLY_ALWAYS);
+        for (uint32_t entryIndex : m_liveEntries)
+        {
+            const Entry& entry = m_entries[entryIndex];
+            if (!entry.m_isWorld || entry.m_mode != mode)
+            {
+                continue;
+            }
+            if (mode == DebugRenderMode::X_RAY)
+            {
+                // Faded pass through occluders, then the regular depth-tested pass on top
+                Entry faded     = entry;
+                faded.m_color.a = static_cast<unsigned char>(entry.m_color.a / 4);
+                DrawEntry(faded);
+                g_theRenderDevice->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
+                DrawEntry(entry);
+                g_theRenderDevice->SetDepthMode(DepthMode::READ_ONLY_ALWAYS);
+                continue;
+            }
+            DrawEntry(entry);
+        }
+    }
+}
+
+void DebugTextRenderer::RenderScreen() const
+{
+    if (!m_font || m_liveEntries.empty())
+    {
+        return;
+    }
+
+    g_theRenderDevice->SetBlendMode(BlendMode::ALPHA);
+    g_theRenderDevice->SetSamplerMode(SamplerMode::POINT_CLAMP);
+    g_theRenderDevice->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
+    g_theRenderDevice->SetDepthMode(DepthMode::READ_ONLY_ALWAYS);
+    g_theRenderDevice->BindTexture(&m_font->GetTexture());
+    for (uint32_t entryIndex : m_liveEntries)
+    {
+        const Entry& entry = m_entries[entryIndex];
+        if (!entry.m_isWorld)
+        {
+            DrawEntry(entry);
+        }
+    }
+}
+
+void DebugTextRenderer::Clear()
+{
+    while (!m_liveEntries.empty())
+    {
+        ReleaseEntry(m_liveEntries.back());
+    }
+}
+
+DebugTextHandle DebugTextRenderer::AddEntry(std::string_view text, const Mat44& transform, float cellHeight, const Rgba8& color, DebugRenderMode mode, const Vec2& alignment,
+                                            bool isWorld, float duration)
+{
+    uint32_t entryIndex;
+    if (!m_freeEntries.empty())
+    {
+        entryIndex = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    }
+    else
+    {
+        entryIndex = static_cast<uint32_t>(m_entries.size());
+        m_entries.emplace_back();
+    }
+
+    Entry& entry          = m_entries[entryIndex];
+    entry.m_layoutId      = AcquireLayout(text, cellHeight, alignment, isWorld);
+    entry.m_transform     = transform;
+    entry.m_color         = color;
+    entry.m_cellHeight    = cellHeight;
+    entry.m_alignment     = alignment;
+    entry.m_mode          = mode;
+    entry.m_isWorld       = isWorld;
+    entry.m_expirySeconds = duration < 0.f ? -1.0 : m_currentSeconds + static_cast<double>(duration);
+    entry.m_liveIndex     = static_cast<uint32_t>(m_liveEntries.size());
+    m_liveEntries.push_back(entryIndex);
+
+    DebugTextHandle handle;
+    handle.m_index      = entryIndex;
+    handle.m_generation = entry.m_generation;
+    return handle;
+}
+
+DebugTextRenderer::Entry* DebugTextRenderer::GetEntry(DebugTextHandle handle)
+{
+    return IsValid(handle) ? &m_entries[handle.m_index] : nullptr;
+}
+
+void DebugTextRenderer::ReleaseEntry(uint32_t entryIndex)
+{
+    Entry&   entry     = m_entries[entryIndex];
+    uint32_t liveIndex = entry.m_liveIndex;
+    uint32_t lastEntry = m_liveEntries.back();
+
+    m_liveEntries[liveIndex]         = lastEntry;
+    m_entries[lastEntry].m_liveIndex = liveIndex;
+    m_liveEntries.pop_back();
+
+    ReleaseLayout(entry.m_layoutId);
+    entry.m_liveIndex = DebugTextHandle::INVALID_INDEX;
+    ++entry.m_generation;
+    m_freeEntries.push_back(entryIndex);
+}
+
+uint64_t DebugTextRenderer::AcquireLayout(std::string_view text, float cellHeight, const Vec2& alignment, bool isWorld)
+{
+    bool     found    = false;
+    uint64_t layoutId = FindLayoutSlot(text, cellHeight, alignment, isWorld, found);
+    if (!found)
+    {
+        Layout& layout            = m_layouts[layoutId];
+        layout.m_key.m_text       = std::string(text);
+        layout.m_key.m_font       = m_font;
+        layout.m_key.m_cellHeight = cellHeight;
+        layout.m_key.m_alignment  = alignment;
+        layout.m_key.m_isWorld    = isWorld;
+        BuildLayout(layout);
+    }
+    ++m_layouts.at(layoutId).m_refCount;
+    return layoutId;
+}
+
+void DebugTextRenderer::ReleaseLayout(uint64_t layoutId)
+{
+    Layout& layout = m_layouts.at(layoutId);
+    --layout.m_refCount;
+    layout.m_lastUsedFrame = m_frameNumber;
+}
+
+uint64_t DebugTextRenderer::FindLayoutSlot(std::string_view text, float cellHeight, const Vec2& alignment, bool isWorld, bool& outFound) const
+{
+    uint64_t layoutId = HashString64(text);
+    layoutId          = MixHash(layoutId, reinterpret_cast<uintptr_t>(m_font));
+    layoutId          = MixHash(layoutId, FloatBits(cellHeight));
+    layoutId          = MixHash(layoutId, FloatBits(alignment.x) << 32 | FloatBits(alignment.y));
+    layoutId          = MixHash(layoutId, isWorld ? 1u : 0u);
+
+    // Probe past the rare 64-bit collision with a different key
+    for (auto it = m_layouts.find(layoutId); it != m_layouts.end(); it = m_layouts.find(layoutId))
+    {
+        if (it->second.m_key.Matches(text, m_font, cellHeight, alignment, isWorld))
+        {
+            outFound = true;
+            return layoutId;
+        }
+        layoutId = layoutId * FNV1A_64_PRIME + 1;
+    }
+    outFound = false;
+    return layoutId;
+}
+
+void DebugTextRenderer::BuildLayout(Layout& layout)
+{
+    ++m_layoutBuildCount;
+    layout.m_vertexes.clear();
+    if (!m_font)
+    {
+        return;
+    }
+
+    const LayoutKey& key = layout.m_key;
+    if (key.m_isWorld)
+    {
+        m_font->AddVertsForText3DAtOriginXForward(layout.m_vertexes, key.m_cellHeight, key.m_text, Rgba8::WHITE, m_cellAspect, key.m_alignment);
+    }
+    else
+    {
+        float textWidth = m_font->GetTextWidth(key.m_cellHeight, key.m_text, m_cellAspect);
+        m_font->AddVertsForText2D(layout.m_vertexes, Vec2(-key.m_alignment.x * textWidth, -key.m_alignment.y * key.m_cellHeight), key.m_cellHeight, key.m_text, Rgba8::WHITE,
+                                  m_cellAspect);
+    }
+}
+
+void DebugTextRenderer::DrawEntry(const Entry& entry) const
+{
+    const Layout& layout = m_layouts.at(entry.m_layoutId);
+    if (layout.m_vertexes.empty())
+    {
+        return;
+    }
+    g_theRenderDevice->SetModelConstants(entry.m_transform, entry.m_color);
+    g_theRenderDevice->DrawVertexArray(layout.m_vertexes);
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Renderer/DebugRenderSystem.hpp"
+#include "Game/Framework/StringHash.hpp"
+
+class BitmapFont;
+
+/// Refers to one text entry of a DebugTextRenderer, stale once the entry is removed or expires
+struct DebugTextHandle
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t m_index      = INVALID_INDEX;
+    uint32_t m_generation = 0;
+
+    bool IsValid() const { return m_index != INVALID_INDEX; }
+};
+
+//-----------------------------------------------------------------------------------------------
+// Game-side debug text with cached glyph layout. Laid-out glyph quads are kept in a cache keyed by
+// string content, font, cell height and alignment; entries share a layout when those match, and a
+// layout is only tessellated the first time its key is seen. Quads are laid out around the text's
+// own origin in white, so moving or recoloring an entry goes through the model constants and never
+// touches its vertexes.
+//
+// Entries are persistent and addressed by handle. SetText() updates an entry in place: unchanged
+// text is a string compare, and changed text that no other entry shares rebuilds into the same
+// cache node, reusing its vertex capacity. Layouts nobody references are evicted after a while.
+//
+// Durations follow the engine's debug render convention: 0 draws for one frame, negative lives
+// until removed.
+//
+class DebugTextRenderer
+{
+public:
+    static constexpr uint64_t LAYOUT_EVICTION_FRAMES = 120;
+
+    DebugTextRenderer() = default;
+    DebugTextRenderer(const DebugTextRenderer&)            = delete;
+    DebugTextRenderer& operator=(const DebugTextRenderer&) = delete;
+
+    /// No font (headless) keeps all bookkeeping but lays out and draws nothing
+    void SetFont(BitmapFont* font, float cellAspect);
+
+    /// World text lies in the plane facing +X of transform, like DebugAddWorldText
+    DebugTextHandle AddWorldText(std::string_view text, const Mat44& transform, float textHeight, const Rgba8& color, DebugRenderMode mode = DebugRenderMode::USE_DEPTH,
+                                 const Vec2& alignment = Vec2(0.5f, 0.5f), float duration = -1.f);
+    /// Screen text is placed with its alignment point at position, e.g. (0, 1) anchors the top-left corner
+    DebugTextHandle AddScreenText(std::string_view text, const Vec2& position, float cellHeight, const Rgba8& color = Rgba8::WHITE, const Vec2& alignment = Vec2(0.f, 1.f),
+                                  float duration = -1.f);
+
+    void SetText(DebugTextHandle handle, std::string_view text);
+    void SetColor(DebugTextHandle handle, const Rgba8& color);
+    void SetWorldTransform(DebugTextHandle handle, const Mat44& transform);
+    void SetScreenPosition(DebugTextHandle handle, const Vec2& position);
+    void Remove(DebugTextHandle& handle);
+    bool IsValid(DebugTextHandle handle) const;
+
+    /// Expires timed entries and evicts unreferenced layouts
+    void BeginFrame(double currentSeconds);
+    void RenderWorld() const;
+    void RenderScreen() const;
+    void Clear();
+
+    int      GetLiveTextCount() const { return static_cast<int>(m_liveEntries.size()); }
+    int      GetCachedLayoutCount() const { return static_cast<int>(m_layouts.size()); }
+    uint64_t GetLayoutBuildCount() const { return m_layoutBuildCount; }
+
+private:
+    struct LayoutKey
+    {
+        std::string       m_text;
+        const BitmapFont* m_font       = nullptr;
+        float             m_cellHeight = 0.f;
+        Vec2              m_alignment;
+        bool              m_isWorld = false;
+
+        bool Matches(std::string_view text, const BitmapFont* font, float cellHeight, const Vec2& alignment, bool isWorld) const;
+    };
+
+    struct Layout
+    {
+        LayoutKey               m_key;
+        std::vector<Vertex_PCU> m_vertexes; // Around the text origin, white
+        int                     m_refCount      = 0;
+        uint64_t                m_lastUsedFrame = 0; // Frame of the last release, for eviction
+    };
+
+    struct Entry
+    {
+        uint64_t        m_layoutId = 0;
+        Mat44           m_transform; // World transform, or a translation to the screen position
+        Rgba8           m_color;
+        float           m_cellHeight = 0.f;
+        Vec2            m_alignment;
+        DebugRenderMode m_mode          = DebugRenderMode::USE_DEPTH;
+        bool            m_isWorld       = false;
+        double          m_expirySeconds = -1.0; // Negative never expires
+        uint32_t        m_generation    = 0;
+        uint32_t        m_liveIndex     = DebugTextHandle::INVALID_INDEX;
+    };
+
+    DebugTextHandle AddEntry(std::string_view text, const Mat44& transform, float cellHeight, const Rgba8& color, DebugRenderMode mode, const Vec2& alignment, bool isWorld,
+                             float duration);
+    Entry*          GetEntry(DebugTextHandle handle);
+    void            ReleaseEntry(uint32_t entryIndex);
+    uint64_t        AcquireLayout(std::string_view text, float cellHeight, const Vec2& alignment, bool isWorld);
+    void            ReleaseLayout(uint64_t layoutId);
+    uint64_t        FindLayoutSlot(std::string_view text, float cellHeight, const Vec2& alignment, bool isWorld, bool& outFound) const;
+    void            BuildLayout(Layout& layout);
+    void            DrawEntry(const Entry& entry) const;
+
+    BitmapFont* m_font       = nullptr;
+    float       m_cellAspect = 1.f;
+
+    std::unordered_map<uint64_t, Layout, PrehashedKeyHasher> m_layouts;
+
+    std::vector<Entry>    m_entries;     // Pool, never shrinks
+    std::vector<uint32_t> m_freeEntries;
+    std::vector<uint32_t> m_liveEntries; // Dense list of live entry indexes, swap-removed
+
+    double   m_currentSeconds   = 0.0;
+    uint64_t m_frameNumber      = 0;
+    uint64_t m_layoutBuildCount = 0;
+};
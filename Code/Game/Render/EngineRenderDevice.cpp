@@ -0,0 +1,184 @@
+#include "EngineRenderDevice.hpp"
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Engine/Renderer/IndexBuffer.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+#include "Game/Render/VertexBaking.hpp"
+
+EngineRenderDevice::EngineRenderDevice(IRenderer* renderer) : m_renderer(renderer)
+{
+}
+
+EngineRenderDevice::~EngineRenderDevice()
+{
+    for (GpuMesh& mesh : m_gpuMeshes)
+    {
+        ReleaseGpuMesh(mesh);
+    }
+}
+
+void EngineRenderDevice::OnBeginCamera(const Camera& camera)
+{
+    m_renderer->BeginCamera(camera);
+}
+
+void EngineRenderDevice::OnEndCamera(const Camera& camera)
+{
+    m_renderer->EndCamera(camera);
+}
+
+void EngineRenderDevice::OnClearScreen(const Rgba8& clearColor)
+{
+    m_renderer->ClearScreen(clearColor);
+}
+
+Texture* EngineRenderDevice::OnCreateOrGetTexture(const char* imageFilePath)
+{
+    return m_renderer->CreateOrGetTexture(imageFilePath);
+}
+
+BitmapFont* EngineRenderDevice::OnCreateOrGetBitmapFont(const char* bitmapFontFilePathWithNoExtension)
+{
+    return m_renderer->CreateOrGetBitmapFont(bitmapFontFilePathWithNoExtension);
+}
+
+void EngineRenderDevice::OnSetModelConstants(const Mat44& modelToWorldTransform, const Rgba8& modelColor)
+{
+    m_renderer->SetModelConstants(modelToWorldTransform, modelColor);
+}
+
+void EngineRenderDevice::OnSetBlendMode(BlendMode blendMode)
+{
+    m_renderer->SetBlendMode(blendMode);
+}
+
+void EngineRenderDevice::OnSetRasterizerMode(RasterizerMode rasterizerMode)
+{
+    m_renderer->SetRasterizerMode(rasterizerMode);
+}
+
+void EngineRenderDevice::OnSetSamplerMode(SamplerMode samplerMode)
+{
+    m_renderer->SetSamplerMode(samplerMode);
+}
+
+void EngineRenderDevice::OnSetDepthMode(DepthMode depthMode)
+{
+    m_renderer->SetDepthMode(depthMode);
+}
+
+void EngineRenderDevice::OnBindTexture(Texture* texture)
+{
+    m_renderer->BindTexture(texture);
+}
+
+void EngineRenderDevice::OnDrawVertexArray(int numVertexes, const Vertex_PCU* vertexes)
+{
+    m_renderer->DrawVertexArray(numVertexes, vertexes);
+}
+
+void EngineRenderDevice::OnDrawIndexedVertexArray(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes)
+{
+    // The engine's immediate path only takes triangle lists, so dynamic indexed geometry is
+    // expanded here. Static indexed meshes go through CreateMesh and stay indexed on the GPU.
+    m_expandedVertexes.clear();
+    m_expandedVertexes.reserve(indexes.size());
+    for (unsigned int index : indexes)
+    {
+        m_expandedVertexes.push_back(vertexes[index]);
+    }
+    m_renderer->DrawVertexArray(static_cast<int>(m_expandedVertexes.size()), m_expandedVertexes.data());
+}
+
+void EngineRenderDevice::OnCreateMesh(uint32_t slot, const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes)
+{
+    if (slot >= m_gpuMeshes.size())
+    {
+        m_gpuMeshes.resize(slot + 1);
+    }
+
+    GpuMesh& mesh = m_gpuMeshes[slot];
+    ReleaseGpuMesh(mesh);
+    if (vertexes.empty())
+    {
+        return;
+    }
+
+    if (IsCpuBatched(static_cast<int>(vertexes.size()), static_cast<int>(indexes.size())))
+    {
+        mesh.m_vertexes = vertexes;
+        mesh.m_indexes  = indexes;
+    }
+
+    size_t vertexBytes  = sizeof(Vertex_PCU) * vertexes.size();
+    mesh.m_vertexBuffer = m_renderer->CreateVertexBuffer(vertexBytes, sizeof(Vertex_PCU));
+    m_renderer->CopyCPUToGPU(vertexes.data(), vertexBytes, mesh.m_vertexBuffer);
+
+    if (!indexes.empty())
+    {
+        size_t indexBytes  = sizeof(unsigned int) * indexes.size();
+        mesh.m_indexBuffer = m_renderer->CreateIndexBuffer(indexBytes);
+        m_renderer->CopyCPUToGPU(indexes.data(), indexBytes, mesh.m_indexBuffer);
+    }
+}
+
+void EngineRenderDevice::OnDestroyMesh(uint32_t slot)
+{
+    ReleaseGpuMesh(m_gpuMeshes[slot]);
+}
+
+void EngineRenderDevice::OnDrawMesh(uint32_t slot, int vertexCount, int indexCount)
+{
+    const GpuMesh& mesh = m_gpuMeshes[slot];
+    if (!mesh.m_vertexBuffer)
+    {
+        return;
+    }
+    if (mesh.m_indexBuffer)
+    {
+        m_renderer->DrawVertexIndexed(mesh.m_vertexBuffer, mesh.m_indexBuffer, indexCount);
+    }
+    else
+    {
+        m_renderer->DrawVertexBuffer(mesh.m_vertexBuffer, vertexCount);
+    }
+}
+
+void EngineRenderDevice::OnDrawMeshBatched(uint32_t slot, const std::vector<MeshInstance>& instances)
+{
+    // IRenderer exposes no instanced draw, so the instances are pre-transformed into one dynamic
+    // triangle list: a single submission, at the cost of uploading every instance's vertexes.
+    const GpuMesh& mesh                = m_gpuMeshes[slot];
+    size_t         verticesPerInstance = mesh.m_indexes.empty() ? mesh.m_vertexes.size() : mesh.m_indexes.size();
+    m_expandedVertexes.clear();
+    m_expandedVertexes.reserve(verticesPerInstance * instances.size());
+    for (const MeshInstance& instance : instances)
+    {
+        if (mesh.m_indexes.empty())
+        {
+            for (const Vertex_PCU& vertex : mesh.m_vertexes)
+            {
+                m_expandedVertexes.push_back(BakeVertex(vertex, instance.m_modelToWorldTransform, instance.m_tint));
+            }
+        }
+        else
+        {
+            for (unsigned int index : mesh.m_indexes)
+            {
+                m_expandedVertexes.push_back(BakeVertex(mesh.m_vertexes[index], instance.m_modelToWorldTransform, instance.m_tint));
+            }
+        }
+    }
+    m_renderer->DrawVertexArray(static_cast<int>(m_expandedVertexes.size()), m_expandedVertexes.data());
+}
+
+void EngineRenderDevice::ReleaseGpuMesh(GpuMesh& mesh)
+{
+    delete mesh.m_vertexBuffer;
+    delete mesh.m_indexBuffer;
+    mesh.m_vertexBuffer = nullptr;
+    mesh.m_indexBuffer  = nullptr;
+    mesh.m_vertexes.clear();
+    mesh.m_indexes.clear();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "Game/Render/RenderDevice.hpp"
+
+class IRenderer;
+class VertexBuffer;
+class IndexBuffer;
+
+/// RenderDevice backend that forwards every call to the engine IRenderer
+class EngineRenderDevice : public RenderDevice
+{
+public:
+    explicit EngineRenderDevice(IRenderer* renderer);
+    ~EngineRenderDevice() override;
+
+    bool IsHeadless() const override { return false; }
+
+protected:
+    void OnBeginCamera(const Camera& camera) override;
+    void OnEndCamera(const Camera& camera) override;
+    void OnClearScreen(const Rgba8& clearColor) override;
+    Texture* OnCreateOrGetTexture(const char* imageFilePath) override;
+    BitmapFont* OnCreateOrGetBitmapFont(const char* bitmapFontFilePathWithNoExtension) override;
+    void OnSetModelConstants(const Mat44& modelToWorldTransform, const Rgba8& modelColor) override;
+    void OnSetBlendMode(BlendMode blendMode) override;
+    void OnSetRasterizerMode(RasterizerMode rasterizerMode) override;
+    void OnSetSamplerMode(SamplerMode samplerMode) override;
+    void OnSetDepthMode(DepthMode depthMode) override;
+    void OnBindTexture(Texture* texture) override;
+    void OnDrawVertexArray(int numVertexes, const Vertex_PCU* vertexes) override;
+    void OnDrawIndexedVertexArray(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes) override;
+    void OnCreateMesh(uint32_t slot, const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes) override;
+    void OnDestroyMesh(uint32_t slot) override;
+    void OnDrawMesh(uint32_t slot, int vertexCount, int indexCount) override;
+    void OnDrawMeshBatched(uint32_t slot, const std::vector<MeshInstance>& instances) override;
+
+private:
+    struct GpuMesh
+    {
+        VertexBuffer* m_vertexBuffer = nullptr;
+        IndexBuffer*  m_indexBuffer  = nullptr;
+
+        // CPU copy, kept only for meshes small enough to be CPU batched
+        std::vector<Vertex_PCU>   m_vertexes;
+        std::vector<unsigned int> m_indexes;
+    };
+
+    void ReleaseGpuMesh(GpuMesh& mesh);
+
+    IRenderer*              m_renderer = nullptr;
+    std::vector<GpuMesh>    m_gpuMeshes;        // Indexed by RenderDevice mesh slot
+    std::vector<Vertex_PCU> m_expandedVertexes; // Scratch for the dynamic indexed and batched paths
+};
@@ -0,0 +1,110 @@
+#include "EntityMeshRenderer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/EntityStore.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+
+EntityMeshRenderer::~EntityMeshRenderer()
+{
+    Clear();
+}
+
+uint16_t EntityMeshRenderer::RegisterMesh(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes, Texture* texture)
+{
+    // The next id must stay below NO_MESH, which entities use for "no mesh"
+    ASSERT_OR_DIE(m_meshes.size() < EntityStore::NO_MESH, "EntityMeshRenderer: out of 16-bit mesh ids");
+    Mesh mesh;
+    mesh.m_mesh        = g_theRenderDevice->CreateMesh(vertexes, indexes);
+    mesh.m_localBounds = ComputeBoundingVolume(vertexes);
+    mesh.m_texture     = texture;
+    m_meshes.push_back(std::move(mesh));
+    return static_cast<uint16_t>(m_meshes.size() - 1);
+}
+
+void EntityMeshRenderer::Clear()
+{
+    for (Mesh& mesh : m_meshes)
+    {
+        g_theRenderDevice->DestroyMesh(mesh.m_mesh);
+    }
+    m_meshes.clear();
+}
+
+void EntityMeshRenderer::SubmitTo(RenderCommandQueue& queue, const EntityStore& entities, const Frustum* frustum) const
+{
+    GatherInstances(entities, m_instances);
+    SubmitInstances(queue, m_instances, frustum);
+}
+
+void EntityMeshRenderer::GatherInstances(const EntityStore& entities, InstanceArrays& outInstances) const
+{
+    outInstances.resize(m_meshes.size());
+    for (std::vector<MeshInstance>& instances : outInstances)
+    {
+        instances.clear();
+    }
+
+    const std::pmr::vector<uint16_t>& meshIds         = entities.GetMeshIds();
+    const std::pmr::vector<uint8_t>&  flags           = entities.GetFlags();
+    const std::pmr::vector<Mat44>&    worldTransforms = entities.GetWorldTransforms();
+    const std::pmr::vector<Rgba8>&    colors          = entities.GetColors();
+    const size_t                      meshCount       = m_meshes.size();
+    for (size_t i = 0; i < entities.GetCount(); ++i)
+    {
+        if (meshIds[i] >= meshCount || (flags[i] & (EntityStore::FLAG_HIDDEN | EntityStore::FLAG_DEAD)) != 0)
+        {
+            continue;
+        }
+        MeshInstance instance;
+        instance.m_modelToWorldTransform = worldTransforms[i];
+        instance.m_tint                  = colors[i];
+        outInstances[meshIds[i]].push_back(instance);
+    }
+}
+
+void EntityMeshRenderer::SubmitInstances(RenderCommandQueue& queue, InstanceArrays& instances, const Frustum* frustum) const
+{
+    m_submittedInstanceCount = 0;
+    const size_t meshCount   = std::min(m_meshes.size(), instances.size());
+    for (size_t meshId = 0; meshId < meshCount; ++meshId)
+    {
+        const Mesh&                mesh          = m_meshes[meshId];
+        std::vector<MeshInstance>& meshInstances = instances[meshId];
+        if (frustum && !meshInstances.empty())
+        {
+            CullInstances(mesh, meshInstances, *frustum);
+        }
+        if (meshInstances.empty())
+        {
+            continue;
+        }
+
+        RenderPacketState state;
+        state.m_blendMode = BlendMode::OPAQUE;
+        state.m_texture   = mesh.m_texture;
+        queue.DrawMeshInstanced(state, mesh.m_mesh, meshInstances);
+        m_submittedInstanceCount += static_cast<int>(meshInstances.size());
+    }
+}
+
+void EntityMeshRenderer::CullInstances(const Mesh& mesh, std::vector<MeshInstance>& instances, const Frustum& frustum) const
+{
+    m_culler.Clear();
+    for (const MeshInstance& instance : instances)
+    {
+        m_culler.Add(TransformBoundingVolume(mesh.m_localBounds, instance.m_modelToWorldTransform));
+    }
+    m_culler.Cull(frustum, m_visibleIndexes);
+
+    // Visible indexes ascend, so compacting in place never overwrites an instance still to be read
+    for (size_t i = 0; i < m_visibleIndexes.size(); ++i)
+    {
+        instances[i] = instances[m_visibleIndexes[i]];
+    }
+    instances.resize(m_visibleIndexes.size());
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Game/Render/BoundingVolume.hpp"
+#include "Game/Render/FrustumCuller.hpp"
+#include "Game/Render/MeshHandle.hpp"
+#include "Game/Render/RenderDevice.hpp"
+
+class EntityStore;
+struct Frustum;
+class RenderCommandQueue;
+class Texture;
+
+//-----------------------------------------------------------------------------------------------
+// Draws the entities of an EntityStore as instances of registered meshes. Each frame SubmitTo()
+// makes one linear sweep over the store's columns, sorting every visible entity's cached world
+// transform and color into its mesh's instance array, then issues one DrawMeshInstanced per
+// mesh. Given a frustum, instances whose bounds fall outside it are dropped before the draw.
+//
+// Entities carry a mesh id returned by RegisterMesh(); NO_MESH, hidden and killed entities are
+// skipped. The store's world transforms must be current (UpdateWorldTransforms) before submitting.
+//
+// The sweep and the draw also run apart: GatherInstances() copies the instances out of the store
+// into caller-owned arrays (a RenderSnapshot), and SubmitInstances() later culls and records them,
+// possibly on another thread while the store is being simulated again.
+//
+class EntityMeshRenderer
+{
+public:
+    EntityMeshRenderer() = default;
+    ~EntityMeshRenderer();
+    EntityMeshRenderer(const EntityMeshRenderer&)            = delete;
+    EntityMeshRenderer& operator=(const EntityMeshRenderer&) = delete;
+
+    /// Uploads the mesh once and returns the id entities use to draw it
+    uint16_t RegisterMesh(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes, Texture* texture = nullptr);
+    void     Clear();
+
+    /// The queue references the instance arrays until it flushes, so submit at most once per flush
+    void SubmitTo(RenderCommandQueue& queue, const EntityStore& entities, const Frustum* frustum = nullptr) const;
+
+    /// One instance array per registered mesh, indexed by mesh id
+    using InstanceArrays = std::vector<std::vector<MeshInstance>>;
+    void GatherInstances(const EntityStore& entities, InstanceArrays& outInstances) const;
+    /// Culls the arrays in place, then records one instanced draw per non-empty mesh
+    void SubmitInstances(RenderCommandQueue& queue, InstanceArrays& instances, const Frustum* frustum = nullptr) const;
+
+    int GetMeshCount() const { return static_cast<int>(m_meshes.size()); }
+    /// Instances submitted by the last SubmitTo() or SubmitInstances(), after culling
+    int GetSubmittedInstanceCount() const { return m_submittedInstanceCount; }
+
+private:
+    struct Mesh
+    {
+        MeshHandle     m_mesh;
+        BoundingVolume m_localBounds;
+        Texture*       m_texture = nullptr;
+    };
+
+    void CullInstances(const Mesh& mesh, std::vector<MeshInstance>& instances, const Frustum& frustum) const;
+
+    std::vector<Mesh>             m_meshes;
+    mutable InstanceArrays        m_instances; // Rebuilt every SubmitTo(), capacity persists
+    mutable FrustumCuller         m_culler;
+    mutable std::vector<uint32_t> m_visibleIndexes;
+    mutable int                   m_submittedInstanceCount = 0;
+};
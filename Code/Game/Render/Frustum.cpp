@@ -0,0 +1,59 @@
+#include "Frustum.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Render/BoundingVolume.hpp"
+
+namespace
+{
+    FrustumPlane MakePlaneThroughPoint(const Vec3& normal, const Vec3& point)
+    {
+        FrustumPlane plane;
+        plane.m_normal   = normal.GetNormalized();
+        plane.m_distance = -DotProduct3D(plane.m_normal, point);
+        return plane;
+    }
+}
+
+Frustum Frustum::MakePerspective(const Vec3& position, const EulerAngles& orientation, float aspect, float fovDegrees, float nearDistance, float farDistance)
+{
+    Vec3 forward, left, up;
+    orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+
+    float tanHalfVertical   = TanDegrees(fovDegrees * 0.5f);
+    float tanHalfHorizontal = tanHalfVertical * aspect;
+
+    // A side plane contains the eye and the edge direction (forward +- side * tan), its inward
+    // normal is forward * tan -+ side
+    Frustum frustum;
+    frustum.m_planes[PLANE_NEAR]   = MakePlaneThroughPoint(forward, position + forward * nearDistance);
+    frustum.m_planes[PLANE_FAR]    = MakePlaneThroughPoint(-forward, position + forward * farDistance);
+    frustum.m_planes[PLANE_LEFT]   = MakePlaneThroughPoint(forward * tanHalfHorizontal - left, position);
+    frustum.m_planes[PLANE_RIGHT]  = MakePlaneThroughPoint(forward * tanHalfHorizontal + left, position);
+    frustum.m_planes[PLANE_TOP]    = MakePlaneThroughPoint(forward * tanHalfVertical - up, position);
+    frustum.m_planes[PLANE_BOTTOM] = MakePlaneThroughPoint(forward * tanHalfVertical + up, position);
+    return frustum;
+}
+
+bool Frustum::IsVisible(const BoundingVolume& bounds) const
+{
+    if (bounds.IsEmpty())
+    {
+        return true;
+    }
+
+    for (const FrustumPlane& plane : m_planes)
+    {
+        float distance  = DotProduct3D(plane.m_normal, bounds.m_center) + plane.m_distance;
+        float boxRadius = std::fabs(plane.m_normal.x) * bounds.m_halfExtents.x + std::fabs(plane.m_normal.y) * bounds.m_halfExtents.y +
+            std::fabs(plane.m_normal.z) * bounds.m_halfExtents.z;
+        if (distance + std::min(boxRadius, bounds.m_radius) < 0.f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+
+struct BoundingVolume;
+struct EulerAngles;
+
+/// Points with DotProduct3D(m_normal, point) + m_distance >= 0 are on the inner side
+struct FrustumPlane
+{
+    Vec3  m_normal;
+    float m_distance = 0.f;
+};
+
+//-----------------------------------------------------------------------------------------------
+// The six planes of a perspective view volume in world space, normals pointing inward. Built from
+// the same inputs Camera::SetPerspectiveView, SetPosition and SetOrientation take, so it matches
+// what the camera draws without reading the camera's projection back.
+//
+struct Frustum
+{
+    enum PlaneIndex
+    {
+        PLANE_NEAR = 0,
+        PLANE_FAR,
+        PLANE_LEFT,
+        PLANE_RIGHT,
+        PLANE_TOP,
+        PLANE_BOTTOM,
+        PLANE_COUNT
+    };
+
+    FrustumPlane m_planes[PLANE_COUNT];
+
+    /// fovDegrees is the vertical field of view, aspect is width over height
+    static Frustum MakePerspective(const Vec3& position, const EulerAngles& orientation, float aspect, float fovDegrees, float nearDistance, float farDistance);
+
+    /// False only when the bounds lie entirely outside one plane. Empty bounds are never culled.
+    bool IsVisible(const BoundingVolume& bounds) const;
+};
@@ -0,0 +1,146 @@
+#include "FrustumCuller.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Game/Render/BoundingVolume.hpp"
+#include "Game/Render/Frustum.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#define FRUSTUM_CULLER_SSE 1
+#include <xmmintrin.h>
+#else
+#define FRUSTUM_CULLER_SSE 0
+#endif
+
+void FrustumCuller::Clear()
+{
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+    m_radius.clear();
+}
+
+void FrustumCuller::Reserve(size_t count)
+{
+    m_centerX.reserve(count);
+    m_centerY.reserve(count);
+    m_centerZ.reserve(count);
+    m_extentX.reserve(count);
+    m_extentY.reserve(count);
+    m_extentZ.reserve(count);
+    m_radius.reserve(count);
+}
+
+uint32_t FrustumCuller::Add(const BoundingVolume& worldBounds)
+{
+    uint32_t index = static_cast<uint32_t>(m_radius.size());
+    m_centerX.push_back(worldBounds.m_center.x);
+    m_centerY.push_back(worldBounds.m_center.y);
+    m_centerZ.push_back(worldBounds.m_center.z);
+    m_extentX.push_back(worldBounds.IsEmpty() ? FLT_MAX : worldBounds.m_halfExtents.x);
+    m_extentY.push_back(worldBounds.IsEmpty() ? FLT_MAX : worldBounds.m_halfExtents.y);
+    m_extentZ.push_back(worldBounds.IsEmpty() ? FLT_MAX : worldBounds.m_halfExtents.z);
+    m_radius.push_back(worldBounds.IsEmpty() ? FLT_MAX : worldBounds.m_radius);
+    return index;
+}
+
+void FrustumCuller::Cull(const Frustum& frustum, std::vector<uint32_t>& outVisibleIndexes) const
+{
+#if FRUSTUM_CULLER_SSE
+    outVisibleIndexes.clear();
+    size_t count       = m_radius.size();
+    size_t vectorCount = count & ~static_cast<size_t>(3);
+
+    // Splat each plane once, the loop below only loads bounds
+    __m128 normalX[Frustum::PLANE_COUNT], normalY[Frustum::PLANE_COUNT], normalZ[Frustum::PLANE_COUNT];
+    __m128 absNormalX[Frustum::PLANE_COUNT], absNormalY[Frustum::PLANE_COUNT], absNormalZ[Frustum::PLANE_COUNT];
+    __m128 distance[Frustum::PLANE_COUNT];
+    for (int planeIndex = 0; planeIndex < Frustum::PLANE_COUNT; ++planeIndex)
+    {
+        const FrustumPlane& plane = frustum.m_planes[planeIndex];
+        normalX[planeIndex]       = _mm_set1_ps(plane.m_normal.x);
+        normalY[planeIndex]       = _mm_set1_ps(plane.m_normal.y);
+        normalZ[planeIndex]       = _mm_set1_ps(plane.m_normal.z);
+        absNormalX[planeIndex]    = _mm_set1_ps(std::fabs(plane.m_normal.x));
+        absNormalY[planeIndex]    = _mm_set1_ps(std::fabs(plane.m_normal.y));
+        absNormalZ[planeIndex]    = _mm_set1_ps(std::fabs(plane.m_normal.z));
+        distance[planeIndex]      = _mm_set1_ps(plane.m_distance);
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    for (size_t i = 0; i < vectorCount; i += 4)
+    {
+        __m128 centerX = _mm_loadu_ps(&m_centerX[i]);
+        __m128 centerY = _mm_loadu_ps(&m_centerY[i]);
+        __m128 centerZ = _mm_loadu_ps(&m_centerZ[i]);
+        __m128 extentX = _mm_loadu_ps(&m_extentX[i]);
+        __m128 extentY = _mm_loadu_ps(&m_extentY[i]);
+        __m128 extentZ = _mm_loadu_ps(&m_extentZ[i]);
+        __m128 radius  = _mm_loadu_ps(&m_radius[i]);
+        __m128 outside = zero;
+        for (int planeIndex = 0; planeIndex < Frustum::PLANE_COUNT; ++planeIndex)
+        {
+            // Same operation order as IsVisibleScalar(), so both paths agree bit for bit
+            __m128 signedDistance = _mm_add_ps(_mm_mul_ps(normalX[planeIndex], centerX), _mm_mul_ps(normalY[planeIndex], centerY));
+            signedDistance        = _mm_add_ps(_mm_add_ps(signedDistance, _mm_mul_ps(normalZ[planeIndex], centerZ)), distance[planeIndex]);
+            __m128 boxRadius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNormalX[planeIndex], extentX), _mm_mul_ps(absNormalY[planeIndex], extentY)),
+                                          _mm_mul_ps(absNormalZ[planeIndex], extentZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(signedDistance, _mm_min_ps(boxRadius, radius)), zero));
+        }
+
+        int visibleMask = ~_mm_movemask_ps(outside) & 0xF;
+        while (visibleMask)
+        {
+            int lane = 0;
+            while (!(visibleMask & (1 << lane)))
+            {
+                ++lane;
+            }
+            outVisibleIndexes.push_back(static_cast<uint32_t>(i + lane));
+            visibleMask &= visibleMask - 1;
+        }
+    }
+
+    for (size_t i = vectorCount; i < count; ++i)
+    {
+        if (IsVisibleScalar(frustum, i))
+        {
+            outVisibleIndexes.push_back(static_cast<uint32_t>(i));
+        }
+    }
+#else
+    CullScalar(frustum, outVisibleIndexes);
+#endif
+}
+
+void FrustumCuller::CullScalar(const Frustum& frustum, std::vector<uint32_t>& outVisibleIndexes) const
+{
+    outVisibleIndexes.clear();
+    for (size_t i = 0; i < m_radius.size(); ++i)
+    {
+        if (IsVisibleScalar(frustum, i))
+        {
+            outVisibleIndexes.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+bool FrustumCuller::IsVisibleScalar(const Frustum& frustum, size_t index) const
+{
+    for (const FrustumPlane& plane : frustum.m_planes)
+    {
+        float signedDistance = plane.m_normal.x * m_centerX[index] + plane.m_normal.y * m_centerY[index] + plane.m_normal.z * m_centerZ[index] + plane.m_distance;
+        float boxRadius      = std::fabs(plane.m_normal.x) * m_extentX[index] + std::fabs(plane.m_normal.y) * m_extentY[index] +
+            std::fabs(plane.m_normal.z) * m_extentZ[index];
+        if (signedDistance + std::min(boxRadius, m_radius[index]) < 0.f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct BoundingVolume;
+struct Frustum;
+
+//-----------------------------------------------------------------------------------------------
+// Batched frustum test over many world-space bounding volumes. Bounds are stored as separate
+// arrays per component so four of them are tested against a plane in one set of SSE operations;
+// each plane uses whichever of the box and sphere is tighter, like Frustum::IsVisible().
+//
+// Typical use per frame: Clear(), Add() every candidate in a known order, then Cull() and map the
+// returned indexes back to the candidates.
+//
+class FrustumCuller
+{
+public:
+    void     Clear();
+    void     Reserve(size_t count);
+    uint32_t Add(const BoundingVolume& worldBounds);
+
+    /// Replaces outVisibleIndexes with the ascending indexes of the bounds that may be visible
+    void Cull(const Frustum& frustum, std::vector<uint32_t>& outVisibleIndexes) const;
+    /// One bound at a time through the same test, the reference Cull() must agree with
+    void CullScalar(const Frustum& frustum, std::vector<uint32_t>& outVisibleIndexes) const;
+
+    size_t GetCount() const { return m_radius.size(); }
+
+private:
+    bool IsVisibleScalar(const Frustum& frustum, size_t index) const;
+
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_extentX;
+    std::vector<float> m_extentY;
+    std::vector<float> m_extentZ;
+    std::vector<float> m_radius; // Empty bounds store a huge radius so they always pass
+};
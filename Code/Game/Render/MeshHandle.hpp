@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+/// Handle to vertex (and optional index) data uploaded once into immutable GPU buffers.
+/// The generation makes a handle to a destroyed and reused slot fail validation.
+struct MeshHandle
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t m_index      = INVALID_INDEX;
+    uint32_t m_generation = 0;
+
+    bool IsValid() const { return m_index != INVALID_INDEX; }
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include "Game/Render/RenderDevice.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// RenderDevice backend with no GPU work: every call is only recorded into RenderStats. Used by the
+// headless frame driver (Test/Test_HeadlessRender) to benchmark the CPU submission path.
+//
+class NullRenderDevice : public RenderDevice
+{
+public:
+    bool IsHeadless() const override { return true; }
+
+protected:
+    void OnBeginCamera(const Camera&) override {}
+    void OnEndCamera(const Camera&) override {}
+    void OnClearScreen(const Rgba8&) override {}
+    Texture* OnCreateOrGetTexture(const char*) override { return nullptr; }
+    BitmapFont* OnCreateOrGetBitmapFont(const char*) override { return nullptr; }
+    void OnSetModelConstants(const Mat44&, const Rgba8&) override {}
+    void OnSetBlendMode(BlendMode) override {}
+    void OnSetRasterizerMode(RasterizerMode) override {}
+    void OnSetSamplerMode(SamplerMode) override {}
+    void OnSetDepthMode(DepthMode) override {}
+    void OnBindTexture(Texture*) override {}
+    void OnDrawVertexArray(int, const Vertex_PCU*) override {}
+    void OnDrawIndexedVertexArray(const std::vector<Vertex_PCU>&, const std::vector<unsigned int>&) override {}
+    void OnCreateMesh(uint32_t, const std::vector<Vertex_PCU>&, const std::vector<unsigned int>&) override {}
+    void OnDestroyMesh(uint32_t) override {}
+    void OnDrawMesh(uint32_t, int, int) override {}
+    void OnDrawMeshBatched(uint32_t, const std::vector<MeshInstance>&) override {}
+};
@@ -0,0 +1,257 @@
+#include "RenderCommandQueue.hpp"
+
+#include <cstring>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Render/RenderDevice.hpp"
+
+namespace
+{
+    // Sort key layout, most significant first
+    constexpr int      SEQUENCE_BITS    = 24;
+    constexpr int      TEXTURE_BITS     = 12;
+    constexpr int      SAMPLER_BITS     = 4;
+    constexpr int      BLEND_BITS       = 4;
+    constexpr int      RASTERIZER_BITS  = 4;
+    constexpr int      DEPTH_BITS       = 4;
+    constexpr int      TEXTURE_SHIFT    = SEQUENCE_BITS;
+    constexpr int      SAMPLER_SHIFT    = TEXTURE_SHIFT + TEXTURE_BITS;
+    constexpr int      BLEND_SHIFT      = SAMPLER_SHIFT + SAMPLER_BITS;
+    constexpr int      RASTERIZER_SHIFT = BLEND_SHIFT + BLEND_BITS;
+    constexpr int      DEPTH_SHIFT      = RASTERIZER_SHIFT + RASTERIZER_BITS;
+    constexpr int      TRANSLUCENT_BIT  = DEPTH_SHIFT + DEPTH_BITS;
+    constexpr uint64_t SEQUENCE_MASK    = (1ull << SEQUENCE_BITS) - 1;
+    constexpr uint32_t TEXTURE_ID_MASK  = (1u << TEXTURE_BITS) - 1;
+
+    static_assert(TRANSLUCENT_BIT < 64, "Sort key fields overflow 64 bits");
+
+    /// LSD radix sort, 8 bits per pass. Passes where every key has the same byte are skipped, so
+    /// a frame with a handful of distinct states costs only a few passes.
+    void RadixSort64(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch)
+    {
+        size_t count = keys.size();
+        if (count < 2)
+        {
+            return;
+        }
+
+        size_t histograms[8][256] = {};
+        for (uint64_t key : keys)
+        {
+            for (int pass = 0; pass < 8; ++pass)
+            {
+                histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+            }
+        }
+
+        scratch.resize(count);
+        uint64_t* source      = keys.data();
+        uint64_t* destination = scratch.data();
+        for (int pass = 0; pass < 8; ++pass)
+        {
+            size_t* histogram = histograms[pass];
+            if (histogram[(source[0] >> (pass * 8)) & 0xFF] == count)
+            {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (int bucket = 0; bucket < 256; ++bucket)
+            {
+                size_t bucketCount = histogram[bucket];
+                histogram[bucket]  = offset;
+                offset += bucketCount;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint64_t key = source[i];
+                destination[histogram[(key >> (pass * 8)) & 0xFF]++] = key;
+            }
+            std::swap(source, destination);
+        }
+
+        if (source != keys.data())
+        {
+            std::memcpy(keys.data(), source, count * sizeof(uint64_t));
+        }
+    }
+}
+
+void RenderCommandQueue::DrawVertexArray(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, const std::vector<Vertex_PCU>& vertexes)
+{
+    RenderPacket packet;
+    packet.m_kind                  = RenderPacket::Kind::VertexArray;
+    packet.m_state                 = state;
+    packet.m_modelToWorldTransform = modelToWorldTransform;
+    packet.m_modelColor            = modelColor;
+    packet.m_vertexes              = &vertexes;
+    Submit(packet);
+}
+
+void RenderCommandQueue::DrawIndexedVertexArray(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, const std::vector<Vertex_PCU>& vertexes,
+                                                const std::vector<unsigned int>& indexes)
+{
+    RenderPacket packet;
+    packet.m_kind                  = RenderPacket::Kind::IndexedVertexArray;
+    packet.m_state                 = state;
+    packet.m_modelToWorldTransform = modelToWorldTransform;
+    packet.m_modelColor            = modelColor;
+    packet.m_vertexes              = &vertexes;
+    packet.m_indexes               = &indexes;
+    Submit(packet);
+}
+
+void RenderCommandQueue::DrawMesh(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, MeshHandle mesh)
+{
+    RenderPacket packet;
+    packet.m_kind                  = RenderPacket::Kind::Mesh;
+    packet.m_state                 = state;
+    packet.m_modelToWorldTransform = modelToWorldTransform;
+    packet.m_modelColor            = modelColor;
+    packet.m_mesh                  = mesh;
+    Submit(packet);
+}
+
+void RenderCommandQueue::DrawMeshInstanced(const RenderPacketState& state, MeshHandle mesh, const std::vector<MeshInstance>& instances)
+{
+    RenderPacket packet;
+    packet.m_kind      = RenderPacket::Kind::MeshInstanced;
+    packet.m_state     = state;
+    packet.m_mesh      = mesh;
+    packet.m_instances = &instances;
+    Submit(packet);
+}
+
+void RenderCommandQueue::Submit(const RenderPacket& packet)
+{
+    uint32_t sequence = static_cast<uint32_t>(m_packets.size());
+    m_packets.push_back(packet);
+    m_sortKeys.push_back(MakeSortKey(packet.m_state, sequence));
+    m_isSorted = false;
+}
+
+uint64_t RenderCommandQueue::MakeSortKey(const RenderPacketState& state, uint32_t sequence)
+{
+    // The sequence is also the packet index Flush() reads back out of the key, it must not wrap
+    ASSERT_OR_DIE(sequence <= SEQUENCE_MASK, "RenderCommandQueue: more packets in one flush than the sort key's sequence bits hold");
+    uint64_t key = sequence;
+    if (state.m_blendMode != BlendMode::OPAQUE)
+    {
+        // Translucent draws keep submission order, only the translucent bit ranks them
+        return key | (1ull << TRANSLUCENT_BIT);
+    }
+    key |= static_cast<uint64_t>(GetTextureSortId(state.m_texture)) << TEXTURE_SHIFT;
+    key |= static_cast<uint64_t>(state.m_samplerMode) << SAMPLER_SHIFT;
+    key |= static_cast<uint64_t>(state.m_blendMode) << BLEND_SHIFT;
+    key |= static_cast<uint64_t>(state.m_rasterizerMode) << RASTERIZER_SHIFT;
+    key |= static_cast<uint64_t>(state.m_depthMode) << DEPTH_SHIFT;
+    return key;
+}
+
+uint32_t RenderCommandQueue::GetTextureSortId(const Texture* texture)
+{
+    // Past TEXTURE_BITS distinct textures the ids alias, which only costs sort quality: Flush()
+    // compares the real state, never the id
+    for (size_t i = 0; i < m_textureIds.size(); ++i)
+    {
+        if (m_textureIds[i] == texture)
+        {
+            return static_cast<uint32_t>(i) & TEXTURE_ID_MASK;
+        }
+    }
+    m_textureIds.push_back(texture);
+    return static_cast<uint32_t>(m_textureIds.size() - 1) & TEXTURE_ID_MASK;
+}
+
+void RenderCommandQueue::Sort()
+{
+    if (!m_isSorted)
+    {
+        RadixSort64(m_sortKeys, m_sortScratch);
+        m_isSorted = true;
+    }
+}
+
+void RenderCommandQueue::Flush(RenderDevice& device)
+{
+    Sort();
+
+    // The first packet binds everything; afterwards only fields that differ are set
+    bool              hasState       = false;
+    bool              hasModelConsts = false;
+    RenderPacketState boundState;
+    Mat44             boundModelToWorld;
+    Rgba8             boundModelColor;
+
+    for (uint64_t key : m_sortKeys)
+    {
+        const RenderPacket&      packet = m_packets[key & SEQUENCE_MASK];
+        const RenderPacketState& state  = packet.m_state;
+
+        if (!hasState || state.m_depthMode != boundState.m_depthMode)
+        {
+            device.SetDepthMode(state.m_depthMode);
+        }
+        if (!hasState || state.m_rasterizerMode != boundState.m_rasterizerMode)
+        {
+            device.SetRasterizerMode(state.m_rasterizerMode);
+        }
+        if (!hasState || state.m_blendMode != boundState.m_blendMode)
+        {
+            device.SetBlendMode(state.m_blendMode);
+        }
+        if (!hasState || state.m_samplerMode != boundState.m_samplerMode)
+        {
+            device.SetSamplerMode(state.m_samplerMode);
+        }
+        if (!hasState || state.m_texture != boundState.m_texture)
+        {
+            device.BindTexture(state.m_texture);
+        }
+        boundState = state;
+        hasState   = true;
+
+        if (packet.m_kind == RenderPacket::Kind::MeshInstanced)
+        {
+            device.DrawMeshInstanced(packet.m_mesh, *packet.m_instances);
+            hasModelConsts = false; // Instanced draws supply their own per-instance constants
+            continue;
+        }
+
+        bool sameModelConstants = hasModelConsts &&
+            std::memcmp(&packet.m_modelToWorldTransform, &boundModelToWorld, sizeof(Mat44)) == 0 &&
+            std::memcmp(&packet.m_modelColor, &boundModelColor, sizeof(Rgba8)) == 0;
+        if (!sameModelConstants)
+        {
+            device.SetModelConstants(packet.m_modelToWorldTransform, packet.m_modelColor);
+            boundModelToWorld = packet.m_modelToWorldTransform;
+            boundModelColor   = packet.m_modelColor;
+            hasModelConsts    = true;
+        }
+
+        switch (packet.m_kind)
+        {
+        case RenderPacket::Kind::VertexArray:
+            device.DrawVertexArray(*packet.m_vertexes);
+            break;
+        case RenderPacket::Kind::IndexedVertexArray:
+            device.DrawIndexedVertexArray(*packet.m_vertexes, *packet.m_indexes);
+            break;
+        case RenderPacket::Kind::Mesh:
+            device.DrawMesh(packet.m_mesh);
+            break;
+        case RenderPacket::Kind::MeshInstanced:
+            break;
+        }
+    }
+
+    Clear();
+}
+
+void RenderCommandQueue::Clear()
+{
+    m_packets.clear();
+    m_sortKeys.clear();
+    m_textureIds.clear();
+    m_isSorted = true;
+}
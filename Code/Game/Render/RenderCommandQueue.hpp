@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Render/MeshHandle.hpp"
+
+struct Vertex_PCU;
+struct MeshInstance;
+class RenderDevice;
+class Texture;
+
+/// Pipeline state a packet needs bound, everything a RenderCommandQueue sorts by
+struct RenderPacketState
+{
+    BlendMode      m_blendMode      = BlendMode::OPAQUE;
+    RasterizerMode m_rasterizerMode = RasterizerMode::SOLID_CULL_BACK;
+    SamplerMode    m_samplerMode    = SamplerMode::POINT_CLAMP;
+    DepthMode      m_depthMode      = DepthMode::READ_WRITE_LESS_EQUAL;
+    Texture*       m_texture        = nullptr;
+};
+
+/// One recorded draw. Geometry is referenced, not copied, and must stay alive until Flush().
+struct RenderPacket
+{
+    enum class Kind : uint8_t
+    {
+        VertexArray,
+        IndexedVertexArray,
+        Mesh,
+        MeshInstanced
+    };
+
+    Kind                             m_kind = Kind::VertexArray;
+    RenderPacketState                m_state;
+    Mat44                            m_modelToWorldTransform;
+    Rgba8                            m_modelColor = Rgba8::WHITE;
+    const std::vector<Vertex_PCU>*   m_vertexes   = nullptr;
+    const std::vector<unsigned int>* m_indexes    = nullptr;
+    const std::vector<MeshInstance>* m_instances  = nullptr;
+    MeshHandle                       m_mesh;
+};
+
+//-----------------------------------------------------------------------------------------------
+// Records draw packets during Render() and submits them sorted by state at Flush(). Each packet
+// gets a 64-bit sort key (depth, rasterizer, blend, sampler, texture, then submission order);
+// the keys are radix sorted and state is only set on the device when it differs from what the
+// previous packet left bound. Translucent packets sort after all opaque ones, in submission
+// order, so blending stays correct.
+//
+class RenderCommandQueue
+{
+public:
+    void DrawVertexArray(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, const std::vector<Vertex_PCU>& vertexes);
+    void DrawIndexedVertexArray(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, const std::vector<Vertex_PCU>& vertexes,
+                                const std::vector<unsigned int>& indexes);
+    void DrawMesh(const RenderPacketState& state, const Mat44& modelToWorldTransform, const Rgba8& modelColor, MeshHandle mesh);
+    void DrawMeshInstanced(const RenderPacketState& state, MeshHandle mesh, const std::vector<MeshInstance>& instances);
+
+    /// Sorts the recorded packets ahead of Flush(), which then only submits. Lets the sort run on
+    /// the render thread while the device calls stay on the thread that owns the device.
+    void Sort();
+    /// Sorts (unless already sorted) and submits every recorded packet, then empties the queue
+    void Flush(RenderDevice& device);
+    /// Drops every recorded packet without submitting
+    void Clear();
+
+    int GetPacketCount() const { return static_cast<int>(m_packets.size()); }
+
+private:
+    void     Submit(const RenderPacket& packet);
+    uint64_t MakeSortKey(const RenderPacketState& state, uint32_t sequence);
+    uint32_t GetTextureSortId(const Texture* texture);
+
+    std::vector<RenderPacket>   m_packets;
+    std::vector<uint64_t>       m_sortKeys;
+    std::vector<uint64_t>       m_sortScratch;
+    std::vector<const Texture*> m_textureIds; // Frame-local texture -> sort id, index is the id
+    bool                        m_isSorted = true;
+};
@@ -0,0 +1,237 @@
+#include "RenderDevice.hpp"
+
+#include "Engine/Core/Vertex_PCU.hpp"
+
+void RenderDevice::BeginFrame()
+{
+    m_lastFrameStats = m_frameStats;
+    m_frameStats     = RenderStats();
+    m_knownStateMask = 0;
+}
+
+void RenderDevice::BeginCamera(const Camera& camera)
+{
+    m_frameStats.m_cameraBegins++;
+    m_knownStateMask = 0;
+    OnBeginCamera(camera);
+}
+
+void RenderDevice::EndCamera(const Camera& camera)
+{
+    OnEndCamera(camera);
+}
+
+void RenderDevice::ClearScreen(const Rgba8& clearColor)
+{
+    OnClearScreen(clearColor);
+}
+
+Texture* RenderDevice::CreateOrGetTexture(const char* imageFilePath)
+{
+    return OnCreateOrGetTexture(imageFilePath);
+}
+
+BitmapFont* RenderDevice::CreateOrGetBitmapFont(const char* bitmapFontFilePathWithNoExtension)
+{
+    return OnCreateOrGetBitmapFont(bitmapFontFilePathWithNoExtension);
+}
+
+void RenderDevice::SetModelConstants(const Mat44& modelToWorldTransform, const Rgba8& modelColor)
+{
+    m_frameStats.m_modelConstantUpdates++;
+    m_frameStats.m_bytesUploaded += sizeof(Mat44) + sizeof(float) * 4;
+    OnSetModelConstants(modelToWorldTransform, modelColor);
+}
+
+void RenderDevice::SetBlendMode(BlendMode blendMode)
+{
+    if ((m_knownStateMask & KNOWN_BLEND) && m_boundBlendMode == blendMode)
+    {
+        m_frameStats.m_redundantStateCalls++;
+    }
+    else
+    {
+        m_frameStats.m_blendModeChanges++;
+    }
+    m_boundBlendMode = blendMode;
+    m_knownStateMask |= KNOWN_BLEND;
+    OnSetBlendMode(blendMode);
+}
+
+void RenderDevice::SetRasterizerMode(RasterizerMode rasterizerMode)
+{
+    if ((m_knownStateMask & KNOWN_RASTERIZER) && m_boundRasterizer == rasterizerMode)
+    {
+        m_frameStats.m_redundantStateCalls++;
+    }
+    else
+    {
+        m_frameStats.m_rasterizerChanges++;
+    }
+    m_boundRasterizer = rasterizerMode;
+    m_knownStateMask |= KNOWN_RASTERIZER;
+    OnSetRasterizerMode(rasterizerMode);
+}
+
+void RenderDevice::SetSamplerMode(SamplerMode samplerMode)
+{
+    if ((m_knownStateMask & KNOWN_SAMPLER) && m_boundSamplerMode == samplerMode)
+    {
+        m_frameStats.m_redundantStateCalls++;
+    }
+    else
+    {
+        m_frameStats.m_samplerModeChanges++;
+    }
+    m_boundSamplerMode = samplerMode;
+    m_knownStateMask |= KNOWN_SAMPLER;
+    OnSetSamplerMode(samplerMode);
+}
+
+void RenderDevice::SetDepthMode(DepthMode depthMode)
+{
+    if ((m_knownStateMask & KNOWN_DEPTH) && m_boundDepthMode == depthMode)
+    {
+        m_frameStats.m_redundantStateCalls++;
+    }
+    else
+    {
+        m_frameStats.m_depthModeChanges++;
+    }
+    m_boundDepthMode = depthMode;
+    m_knownStateMask |= KNOWN_DEPTH;
+    OnSetDepthMode(depthMode);
+}
+
+void RenderDevice::BindTexture(Texture* texture)
+{
+    if ((m_knownStateMask & KNOWN_TEXTURE) && m_boundTexture == texture)
+    {
+        m_frameStats.m_redundantStateCalls++;
+    }
+    else
+    {
+        m_frameStats.m_textureBinds++;
+    }
+    m_boundTexture = texture;
+    m_knownStateMask |= KNOWN_TEXTURE;
+    OnBindTexture(texture);
+}
+
+void RenderDevice::DrawVertexArray(const std::vector<Vertex_PCU>& vertexes)
+{
+    DrawVertexArray(static_cast<int>(vertexes.size()), vertexes.data());
+}
+
+void RenderDevice::DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes)
+{
+    m_frameStats.m_drawCalls++;
+    m_frameStats.m_verticesSubmitted += numVertexes;
+    m_frameStats.m_bytesUploaded += sizeof(Vertex_PCU) * static_cast<size_t>(numVertexes);
+    OnDrawVertexArray(numVertexes, vertexes);
+}
+
+void RenderDevice::DrawIndexedVertexArray(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes)
+{
+    m_frameStats.m_drawCalls++;
+    m_frameStats.m_verticesSubmitted += static_cast<int>(vertexes.size());
+    m_frameStats.m_indicesSubmitted += static_cast<int>(indexes.size());
+    m_frameStats.m_bytesUploaded += sizeof(Vertex_PCU) * vertexes.size() + sizeof(unsigned int) * indexes.size();
+    OnDrawIndexedVertexArray(vertexes, indexes);
+}
+
+MeshHandle RenderDevice::CreateMesh(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes)
+{
+    uint32_t slot;
+    if (!m_freeMeshSlots.empty())
+    {
+        slot = m_freeMeshSlots.back();
+        m_freeMeshSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_meshSlots.size());
+        m_meshSlots.emplace_back();
+    }
+
+    MeshSlot& meshSlot     = m_meshSlots[slot];
+    meshSlot.m_vertexCount = static_cast<int>(vertexes.size());
+    meshSlot.m_indexCount  = static_cast<int>(indexes.size());
+    meshSlot.m_isLive      = true;
+    m_liveMeshCount++;
+
+    m_frameStats.m_bytesUploaded += sizeof(Vertex_PCU) * vertexes.size() + sizeof(unsigned int) * indexes.size();
+    OnCreateMesh(slot, vertexes, indexes);
+
+    MeshHandle handle;
+    handle.m_index      = slot;
+    handle.m_generation = meshSlot.m_generation;
+    return handle;
+}
+
+void RenderDevice::DestroyMesh(MeshHandle& handle)
+{
+    if (!IsMeshValid(handle))
+    {
+        handle = MeshHandle();
+        return;
+    }
+
+    MeshSlot& meshSlot = m_meshSlots[handle.m_index];
+    meshSlot.m_isLive  = false;
+    meshSlot.m_generation++;
+    m_liveMeshCount--;
+    OnDestroyMesh(handle.m_index);
+    m_freeMeshSlots.push_back(handle.m_index);
+    handle = MeshHandle();
+}
+
+void RenderDevice::DrawMesh(MeshHandle handle)
+{
+    if (!IsMeshValid(handle))
+    {
+        return;
+    }
+
+    const MeshSlot& meshSlot = m_meshSlots[handle.m_index];
+    m_frameStats.m_drawCalls++;
+    m_frameStats.m_verticesSubmitted += meshSlot.m_vertexCount;
+    m_frameStats.m_indicesSubmitted += meshSlot.m_indexCount;
+    OnDrawMesh(handle.m_index, meshSlot.m_vertexCount, meshSlot.m_indexCount);
+}
+
+void RenderDevice::DrawMeshInstanced(MeshHandle handle, const std::vector<MeshInstance>& instances)
+{
+    if (!IsMeshValid(handle) || instances.empty())
+    {
+        return;
+    }
+
+    const MeshSlot& meshSlot = m_meshSlots[handle.m_index];
+    int             count    = static_cast<int>(instances.size());
+    m_frameStats.m_instancesSubmitted += count;
+
+    if (!IsCpuBatched(meshSlot.m_vertexCount, meshSlot.m_indexCount))
+    {
+        // Too large to re-upload every frame, draw it from its own buffers once per instance
+        for (const MeshInstance& instance : instances)
+        {
+            SetModelConstants(instance.m_modelToWorldTransform, instance.m_tint);
+            DrawMesh(handle);
+        }
+        return;
+    }
+
+    // The baked vertexes are already in world space and tinted
+    SetModelConstants();
+    int expandedVertexCount = GetDrawnVertexCount(meshSlot.m_vertexCount, meshSlot.m_indexCount) * count;
+    m_frameStats.m_drawCalls++;
+    m_frameStats.m_verticesSubmitted += expandedVertexCount;
+    m_frameStats.m_bytesUploaded += sizeof(Vertex_PCU) * static_cast<size_t>(expandedVertexCount);
+    OnDrawMeshBatched(handle.m_index, instances);
+}
+
+bool RenderDevice::IsMeshValid(MeshHandle handle) const
+{
+    return handle.m_index < m_meshSlots.size() && m_meshSlots[handle.m_index].m_isLive && m_meshSlots[handle.m_index].m_generation == handle.m_generation;
+}
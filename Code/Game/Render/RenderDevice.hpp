@@ -0,0 +1,139 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Render/MeshHandle.hpp"
+#include "Game/Render/RenderStats.hpp"
+
+struct Vertex_PCU;
+class BitmapFont;
+class Camera;
+class Texture;
+
+/// Per-instance data for DrawMeshInstanced, the same values SetModelConstants takes per draw
+struct MeshInstance
+{
+    Mat44 m_modelToWorldTransform;
+    Rgba8 m_tint = Rgba8::WHITE;
+};
+
+//-----------------------------------------------------------------------------------------------
+// The game's render submission seam. Game, Prop and Player submit through g_theRenderDevice
+// rather than calling IRenderer directly; every call is counted into RenderStats before being
+// handed to the backend. Textures and fonts are created through it too, so nothing on the game
+// side needs g_theRenderer.
+//
+// Geometry that never changes is uploaded once with CreateMesh() and drawn by handle, so it costs
+// no per-frame upload bandwidth. DrawVertexArray() remains the dynamic path and re-uploads its
+// vertexes on every call. DrawMeshInstanced() draws one mesh many times, each instance supplying
+// its own model matrix and tint. IRenderer has no instanced draw, so a small mesh (up to
+// CPU_BATCH_MAX_VERTICES drawn vertexes) is CPU batched: the backend bakes every instance into one
+// world-space triangle list and uploads it as a single draw, and the stats count those bytes. A
+// larger mesh is drawn once per instance from its GPU buffers, with its own model constants.
+// EngineRenderDevice forwards to IRenderer, NullRenderDevice does no GPU work at all, which lets
+// the CPU side of Game::Render run headless.
+//
+class RenderDevice
+{
+public:
+    virtual ~RenderDevice() = default;
+
+    virtual bool IsHeadless() const = 0;
+
+    /// Rolls the current counters into GetLastFrameStats() and starts a new frame
+    void BeginFrame();
+
+    void BeginCamera(const Camera& camera);
+    void EndCamera(const Camera& camera);
+    void ClearScreen(const Rgba8& clearColor);
+
+    /// Null backends return nullptr; draws with a null texture bind the default white one
+    Texture*    CreateOrGetTexture(const char* imageFilePath);
+    BitmapFont* CreateOrGetBitmapFont(const char* bitmapFontFilePathWithNoExtension);
+
+    void SetModelConstants(const Mat44& modelToWorldTransform = Mat44(), const Rgba8& modelColor = Rgba8::WHITE);
+    void SetBlendMode(BlendMode blendMode);
+    void SetRasterizerMode(RasterizerMode rasterizerMode);
+    void SetSamplerMode(SamplerMode samplerMode);
+    void SetDepthMode(DepthMode depthMode);
+    void BindTexture(Texture* texture);
+
+    void DrawVertexArray(const std::vector<Vertex_PCU>& vertexes);
+    void DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes);
+    void DrawIndexedVertexArray(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes);
+
+    /// Static meshes, an empty index array draws the vertexes as a plain triangle list
+    MeshHandle CreateMesh(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes = {});
+    void       DestroyMesh(MeshHandle& handle);
+    void       DrawMesh(MeshHandle handle);
+    void       DrawMeshInstanced(MeshHandle handle, const std::vector<MeshInstance>& instances);
+    bool       IsMeshValid(MeshHandle handle) const;
+    int        GetLiveMeshCount() const { return m_liveMeshCount; }
+
+    const RenderStats& GetFrameStats() const { return m_frameStats; }
+    const RenderStats& GetLastFrameStats() const { return m_lastFrameStats; }
+
+protected:
+    virtual void OnBeginCamera(const Camera& camera) = 0;
+    virtual void OnEndCamera(const Camera& camera) = 0;
+    virtual void OnClearScreen(const Rgba8& clearColor) = 0;
+    virtual Texture* OnCreateOrGetTexture(const char* imageFilePath) = 0;
+    virtual BitmapFont* OnCreateOrGetBitmapFont(const char* bitmapFontFilePathWithNoExtension) = 0;
+    virtual void OnSetModelConstants(const Mat44& modelToWorldTransform, const Rgba8& modelColor) = 0;
+    virtual void OnSetBlendMode(BlendMode blendMode) = 0;
+    virtual void OnSetRasterizerMode(RasterizerMode rasterizerMode) = 0;
+    virtual void OnSetSamplerMode(SamplerMode samplerMode) = 0;
+    virtual void OnSetDepthMode(DepthMode depthMode) = 0;
+    virtual void OnBindTexture(Texture* texture) = 0;
+    virtual void OnDrawVertexArray(int numVertexes, const Vertex_PCU* vertexes) = 0;
+    virtual void OnDrawIndexedVertexArray(const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes) = 0;
+    virtual void OnCreateMesh(uint32_t slot, const std::vector<Vertex_PCU>& vertexes, const std::vector<unsigned int>& indexes) = 0;
+    virtual void OnDestroyMesh(uint32_t slot) = 0;
+    virtual void OnDrawMesh(uint32_t slot, int vertexCount, int indexCount) = 0;
+    /// Bake every instance of a CPU-batched mesh into one world-space draw; model constants are already identity
+    virtual void OnDrawMeshBatched(uint32_t slot, const std::vector<MeshInstance>& instances) = 0;
+
+    static constexpr int CPU_BATCH_MAX_VERTICES = 256;
+
+    /// Vertexes one instance expands to, the index count for indexed meshes
+    static int  GetDrawnVertexCount(int vertexCount, int indexCount) { return indexCount > 0 ? indexCount : vertexCount; }
+    static bool IsCpuBatched(int vertexCount, int indexCount) { return GetDrawnVertexCount(vertexCount, indexCount) <= CPU_BATCH_MAX_VERTICES; }
+
+    RenderStats m_frameStats;
+    RenderStats m_lastFrameStats;
+
+    enum KnownStateBits : unsigned
+    {
+        KNOWN_BLEND      = 1 << 0,
+        KNOWN_RASTERIZER = 1 << 1,
+        KNOWN_SAMPLER    = 1 << 2,
+        KNOWN_DEPTH      = 1 << 3,
+        KNOWN_TEXTURE    = 1 << 4,
+    };
+
+    // Last value handed to the backend. A Set* call only counts as a change when the value differs
+    // (or is unknown), otherwise as redundant. Cleared whenever a camera begins, since engine
+    // systems outside this seam may have changed state in between.
+    unsigned       m_knownStateMask   = 0;
+    BlendMode      m_boundBlendMode   = BlendMode::OPAQUE;
+    RasterizerMode m_boundRasterizer  = RasterizerMode::SOLID_CULL_BACK;
+    SamplerMode    m_boundSamplerMode = SamplerMode::POINT_CLAMP;
+    DepthMode      m_boundDepthMode   = DepthMode::READ_WRITE_LESS_EQUAL;
+    Texture*       m_boundTexture     = nullptr;
+
+private:
+    struct MeshSlot
+    {
+        uint32_t m_generation  = 0;
+        int      m_vertexCount = 0;
+        int      m_indexCount  = 0;
+        bool     m_isLive      = false;
+    };
+
+    std::vector<MeshSlot> m_meshSlots;
+    std::vector<uint32_t> m_freeMeshSlots;
+    int                   m_liveMeshCount = 0;
+};
@@ -0,0 +1,124 @@
+#include "RenderPipeline.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+RenderPipeline::RenderPipeline(PrepareFunction prepare, int snapshotCount)
+    : m_prepare(std::move(prepare))
+    , m_snapshotCount(std::clamp(snapshotCount, MIN_SNAPSHOT_COUNT, MAX_SNAPSHOT_COUNT))
+    , m_snapshots(std::make_unique<RenderSnapshot[]>(m_snapshotCount))
+{
+    m_renderThread = std::thread(&RenderPipeline::RenderThreadMain, this);
+}
+
+RenderPipeline::~RenderPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isQuitting = true;
+    }
+    m_captureCondition.notify_one();
+    m_renderThread.join();
+}
+
+RenderSnapshot& RenderPipeline::BeginCapture()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_progressCondition.wait(lock, [this]
+    {
+        return m_captureCount - m_presentCount < static_cast<uint64_t>(m_snapshotCount);
+    });
+    RenderSnapshot& snapshot = m_snapshots[m_captureCount % m_snapshotCount];
+    snapshot.m_frameIndex    = m_captureCount;
+    return snapshot;
+}
+
+void RenderPipeline::EndCapture()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_captureCount;
+    }
+    m_captureCondition.notify_one();
+}
+
+RenderSnapshot* RenderPipeline::AcquirePrepared()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_captureCount - m_presentCount < static_cast<uint64_t>(m_snapshotCount))
+    {
+        return nullptr;
+    }
+    m_progressCondition.wait(lock, [this]
+    {
+        return m_prepareCount > m_presentCount;
+    });
+    return &m_snapshots[m_presentCount % m_snapshotCount];
+}
+
+void RenderPipeline::ReleasePrepared()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_presentCount;
+    }
+    m_progressCondition.notify_all();
+}
+
+void RenderPipeline::Discard()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_progressCondition.wait(lock, [this]
+    {
+        return m_prepareCount == m_captureCount;
+    });
+    // Recorded packets may point at meshes of the game being torn down
+    for (; m_presentCount < m_captureCount; ++m_presentCount)
+    {
+        m_snapshots[m_presentCount % m_snapshotCount].m_worldQueue.Clear();
+    }
+    lock.unlock();
+    m_progressCondition.notify_all();
+}
+
+uint64_t RenderPipeline::GetCaptureCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_captureCount;
+}
+
+uint64_t RenderPipeline::GetPresentCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_presentCount;
+}
+
+void RenderPipeline::RenderThreadMain()
+{
+    MemoryTracker::SetThreadTag(MemoryTag::Render);
+    Profiler::SetThreadName("Render");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_captureCondition.wait(lock, [this]
+        {
+            return m_isQuitting || m_prepareCount < m_captureCount;
+        });
+        if (m_prepareCount == m_captureCount)
+        {
+            return; // Quitting with nothing left to prepare
+        }
+
+        // The main thread does not touch a snapshot between EndCapture() and AcquirePrepared()
+        RenderSnapshot& snapshot = m_snapshots[m_prepareCount % m_snapshotCount];
+        lock.unlock();
+        m_prepare(snapshot);
+        lock.lock();
+
+        ++m_prepareCount;
+        m_progressCondition.notify_all();
+    }
+}
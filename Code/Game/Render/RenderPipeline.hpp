@@ -0,0 +1,74 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Game/Render/RenderSnapshot.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Two-stage frame pipeline over a ring of RenderSnapshots. The main thread captures a snapshot at
+// the end of each frame's simulation; a dedicated render thread prepares captured snapshots in
+// order (culling, packet recording, sorting) while the main thread simulates the next frame; the
+// main thread then presents prepared snapshots, in order, through the render device.
+//
+// With N snapshots the frame presented is N - 1 captures old: double buffering draws last frame's
+// world while this one simulates, triple buffering gives the render thread two frames of slack.
+// Capture blocks only when every snapshot is still waiting to be prepared or presented.
+//
+// The prepare function must not touch the render device; submission stays on the main thread,
+// which owns the device. Only one thread may capture and present.
+//
+class RenderPipeline
+{
+public:
+    static constexpr int MIN_SNAPSHOT_COUNT = 2;
+    static constexpr int MAX_SNAPSHOT_COUNT = 3;
+
+    using PrepareFunction = std::function<void(RenderSnapshot&)>;
+
+    /// snapshotCount is clamped to [MIN_SNAPSHOT_COUNT, MAX_SNAPSHOT_COUNT]
+    explicit RenderPipeline(PrepareFunction prepare, int snapshotCount = MIN_SNAPSHOT_COUNT);
+    ~RenderPipeline();
+    RenderPipeline(const RenderPipeline&)            = delete;
+    RenderPipeline& operator=(const RenderPipeline&) = delete;
+
+    /// The snapshot to fill for this frame; blocks while it is still in flight from N frames ago
+    RenderSnapshot& BeginCapture();
+    /// Hands the snapshot from BeginCapture() to the render thread
+    void EndCapture();
+
+    /// The oldest captured snapshot once the pipeline is full, waiting for the render thread to
+    /// finish preparing it. Null while fewer than N - 1 frames are ahead of it (the first frames).
+    RenderSnapshot* AcquirePrepared();
+    /// Returns the snapshot from AcquirePrepared() to the ring
+    void ReleasePrepared();
+
+    /// Waits for the render thread, then drops every snapshot not yet presented. Call before the
+    /// game that captured them goes away.
+    void Discard();
+
+    int      GetSnapshotCount() const { return m_snapshotCount; }
+    uint64_t GetCaptureCount() const;
+    uint64_t GetPresentCount() const;
+
+private:
+    void RenderThreadMain();
+
+    PrepareFunction                   m_prepare;
+    int                               m_snapshotCount;
+    std::unique_ptr<RenderSnapshot[]> m_snapshots;
+
+    // Monotonic frame counts; snapshot i is m_snapshots[i % m_snapshotCount]
+    uint64_t m_captureCount = 0; // Handed to the render thread
+    uint64_t m_prepareCount = 0; // Finished by the render thread
+    uint64_t m_presentCount = 0; // Released by the main thread
+    bool     m_isQuitting   = false;
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_captureCondition;  // Render thread waits for captures
+    std::condition_variable m_progressCondition; // Main thread waits for prepares and releases
+    std::thread             m_renderThread;
+};
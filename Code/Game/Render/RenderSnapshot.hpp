@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+
+#include "Engine/Renderer/Camera.hpp"
+#include "Game/Render/DebugShapeBatcher.hpp"
+#include "Game/Render/EntityMeshRenderer.hpp"
+#include "Game/Render/Frustum.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Everything the world pass of one frame draws, copied out of the game once its simulation is
+// done. The game never reads a snapshot back, so the render thread can work on it while the next
+// frame is being simulated. Snapshots are recycled by a RenderPipeline; the arrays keep their
+// capacity from one use to the next.
+//
+// Game::CaptureRenderSnapshot() fills the inputs, Game::PrepareRenderSnapshot() culls them and
+// records m_worldQueue on the render thread, Game::Render() flushes it on the main thread.
+//
+struct RenderSnapshot
+{
+    uint64_t m_frameIndex = 0;
+    bool     m_hasWorld   = false; // False in the main menu
+
+    Camera                             m_worldCamera;
+    Frustum                            m_viewFrustum;
+    EntityMeshRenderer::InstanceArrays m_meshInstances; // Per mesh id, culled in place by the render thread
+    DebugShapeBatcher::Batches         m_debugShapes;
+
+    /// World pass packets, recorded and sorted by the render thread. They point into this snapshot
+    /// or at geometry the game never changes once built (the grid batch, registered meshes).
+    RenderCommandQueue m_worldQueue;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+
+//-----------------------------------------------------------------------------------------------
+// Per-frame CPU submission counters recorded by every RenderDevice (including the null backend),
+// so frame cost can be measured and regression-tested without a GPU.
+//
+struct RenderStats
+{
+    int    m_drawCalls            = 0;
+    int    m_verticesSubmitted    = 0;
+    int    m_indicesSubmitted     = 0;
+    int    m_instancesSubmitted   = 0;
+    size_t m_bytesUploaded        = 0;
+    int    m_modelConstantUpdates = 0;
+    int    m_blendModeChanges     = 0;
+    int    m_rasterizerChanges    = 0;
+    int    m_samplerModeChanges   = 0;
+    int    m_depthModeChanges     = 0;
+    int    m_textureBinds         = 0;
+    int    m_redundantStateCalls  = 0; // state set to the value already bound
+    int    m_cameraBegins         = 0;
+
+    int GetStateChangeCount() const
+    {
+        return m_blendModeChanges + m_rasterizerChanges + m_samplerModeChanges + m_depthModeChanges + m_textureBinds;
+    }
+
+    RenderStats& operator+=(const RenderStats& other)
+    {
+        m_drawCalls += other.m_drawCalls;
+        m_verticesSubmitted += other.m_verticesSubmitted;
+        m_indicesSubmitted += other.m_indicesSubmitted;
+        m_instancesSubmitted += other.m_instancesSubmitted;
+        m_bytesUploaded += other.m_bytesUploaded;
+        m_modelConstantUpdates += other.m_modelConstantUpdates;
+        m_blendModeChanges += other.m_blendModeChanges;
+        m_rasterizerChanges += other.m_rasterizerChanges;
+        m_samplerModeChanges += other.m_samplerModeChanges;
+        m_depthModeChanges += other.m_depthModeChanges;
+        m_textureBinds += other.m_textureBinds;
+        m_redundantStateCalls += other.m_redundantStateCalls;
+        m_cameraBegins += other.m_cameraBegins;
+        return *this;
+    }
+};
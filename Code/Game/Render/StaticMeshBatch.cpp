@@ -0,0 +1,119 @@
+#include "StaticMeshBatch.hpp"
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+#include "Game/Render/RenderDevice.hpp"
+#include "Game/Render/VertexBaking.hpp"
+
+StaticMeshBatch::~StaticMeshBatch()
+{
+    Clear();
+}
+
+void StaticMeshBatch::AddVertexes(const std::vector<Vertex_PCU>& localVertexes, const std::vector<unsigned int>& localIndexes, const Mat44& modelToWorldTransform, const Rgba8& tint)
+{
+    unsigned int baseIndex = static_cast<unsigned int>(m_vertexes.size());
+    if (localIndexes.empty())
+    {
+        for (size_t i = 0; i < localVertexes.size(); ++i)
+        {
+            m_indexes.push_back(baseIndex + static_cast<unsigned int>(i));
+        }
+    }
+    else
+    {
+        for (unsigned int localIndex : localIndexes)
+        {
+            m_indexes.push_back(baseIndex + localIndex);
+        }
+    }
+
+    for (const Vertex_PCU& vertex : localVertexes)
+    {
+        m_vertexes.push_back(BakeVertex(vertex, modelToWorldTransform, tint));
+    }
+    m_sourceCount++;
+}
+
+void StaticMeshBatch::AddProp(const Prop& prop)
+{
+    if (prop.m_vertexes.empty())
+    {
+        return;
+    }
+    if (m_sourceCount > 0 && prop.m_texture != m_texture)
+    {
+        enigma::core::LogWarn("Render", "StaticMeshBatch sources must share one texture, prop skipped");
+        return;
+    }
+    m_texture = prop.m_texture;
+    AddVertexes(prop.m_vertexes, prop.m_indexes, prop.GetModelToWorldTransform(), prop.m_color);
+}
+
+void StaticMeshBatch::Clear()
+{
+    if (m_mesh.IsValid())
+    {
+        g_theRenderDevice->DestroyMesh(m_mesh);
+    }
+    m_vertexes.clear();
+    m_indexes.clear();
+    m_texture     = nullptr;
+    m_sourceCount = 0;
+    m_bounds      = BoundingVolume();
+}
+
+void StaticMeshBatch::Upload()
+{
+    if (m_mesh.IsValid())
+    {
+        g_theRenderDevice->DestroyMesh(m_mesh);
+    }
+    if (!m_vertexes.empty())
+    {
+        m_mesh = g_theRenderDevice->CreateMesh(m_vertexes, m_indexes);
+    }
+    m_bounds = ComputeBoundingVolume(m_vertexes);
+}
+
+void StaticMeshBatch::Render() const
+{
+    if (m_vertexes.empty())
+    {
+        return;
+    }
+    g_theRenderDevice->SetModelConstants();
+    g_theRenderDevice->SetBlendMode(BlendMode::OPAQUE);
+    g_theRenderDevice->BindTexture(m_texture);
+    if (m_mesh.IsValid())
+    {
+        g_theRenderDevice->DrawMesh(m_mesh);
+    }
+    else
+    {
+        g_theRenderDevice->DrawIndexedVertexArray(m_vertexes, m_indexes);
+    }
+}
+
+void StaticMeshBatch::SubmitTo(RenderCommandQueue& queue) const
+{
+    if (m_vertexes.empty())
+    {
+        return;
+    }
+    RenderPacketState state;
+    state.m_blendMode = BlendMode::OPAQUE;
+    state.m_texture   = m_texture;
+    if (m_mesh.IsValid())
+    {
+        queue.DrawMesh(state, Mat44(), Rgba8::WHITE, m_mesh);
+    }
+    else
+    {
+        queue.DrawIndexedVertexArray(state, Mat44(), Rgba8::WHITE, m_vertexes, m_indexes);
+    }
+}
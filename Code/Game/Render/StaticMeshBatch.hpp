@@ -0,0 +1,56 @@
+#pragma once
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Game/Render/BoundingVolume.hpp"
+#include "Game/Render/MeshHandle.hpp"
+
+struct Mat44;
+class Prop;
+class RenderCommandQueue;
+class Texture;
+
+//-----------------------------------------------------------------------------------------------
+// Merges never-moving geometry into one indexed vertex array. Each source is baked once: positions are
+// transformed to world space and the source tint is multiplied into the vertex colors, so the
+// whole batch draws with an identity model constant, one blend/texture bind and one draw call.
+//
+// Every source in a batch must share the same texture. Moving a baked prop does not update the
+// batch; call Clear() and re-bake. After Upload() the batch draws from an immutable GPU buffer
+// and costs no per-frame upload.
+//
+class StaticMeshBatch
+{
+public:
+    StaticMeshBatch() = default;
+    ~StaticMeshBatch();
+    StaticMeshBatch(const StaticMeshBatch&)            = delete;
+    StaticMeshBatch& operator=(const StaticMeshBatch&) = delete;
+
+    /// An empty localIndexes treats localVertexes as a plain triangle list
+    void AddVertexes(const std::vector<Vertex_PCU>& localVertexes, const std::vector<unsigned int>& localIndexes, const Mat44& modelToWorldTransform, const Rgba8& tint = Rgba8::WHITE);
+    void AddProp(const Prop& prop);
+    void Clear();
+    void Upload();
+
+    void Render() const;
+    void SubmitTo(RenderCommandQueue& queue) const;
+
+    bool     IsEmpty() const { return m_vertexes.empty(); }
+    int      GetVertexCount() const { return static_cast<int>(m_vertexes.size()); }
+    int      GetIndexCount() const { return static_cast<int>(m_indexes.size()); }
+    int      GetSourceCount() const { return m_sourceCount; }
+    Texture* GetTexture() const { return m_texture; }
+
+    /// World-space bounds of everything baked, fitted by Upload()
+    const BoundingVolume& GetBounds() const { return m_bounds; }
+
+private:
+    std::vector<Vertex_PCU>   m_vertexes;
+    std::vector<unsigned int> m_indexes;
+    Texture*                  m_texture     = nullptr;
+    int                       m_sourceCount = 0;
+    MeshHandle                m_mesh;
+    BoundingVolume            m_bounds;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Mat44.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Applies what the vertex shader would do with the model constants (model matrix and tint) on
+// the CPU, for geometry that is merged into a single world-space draw.
+//
+
+inline unsigned char MultiplyColorChannel(unsigned char a, unsigned char b)
+{
+    return static_cast<unsigned char>((static_cast<unsigned int>(a) * b + 127u) / 255u);
+}
+
+inline Vertex_PCU BakeVertex(const Vertex_PCU& vertex, const Mat44& modelToWorldTransform, const Rgba8& tint)
+{
+    Vertex_PCU baked = vertex;
+    baked.m_position = modelToWorldTransform.TransformPosition3D(vertex.m_position);
+    baked.m_color.r  = MultiplyColorChannel(vertex.m_color.r, tint.r);
+    baked.m_color.g  = MultiplyColorChannel(vertex.m_color.g, tint.g);
+    baked.m_color.b  = MultiplyColorChannel(vertex.m_color.b, tint.b);
+    baked.m_color.a  = MultiplyColorChannel(vertex.m_color.a, tint.a);
+    return baked;
+}
@@ -0,0 +1,252 @@
+#include "Test_Collision.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Collision/CollisionWorld.hpp"
+#include "Game/Collision/SpatialHashGrid.hpp"
+#include "Game/Collision/SweepAndPrune.hpp"
+#include "Game/EntityStore.hpp"
+
+namespace
+{
+    constexpr float AREA_PER_ENTITY = 4.f; // World grows with the entity count, density stays put
+
+    uint64_t MakePairKey(uint32_t a, uint32_t b)
+    {
+        return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+    }
+
+    std::vector<uint64_t> GetSortedPairKeys(Broadphase& broadphase)
+    {
+        std::vector<CollisionPair> pairs;
+        broadphase.FindPairs(pairs);
+        std::vector<uint64_t> keys;
+        for (const CollisionPair& pair : pairs)
+        {
+            keys.push_back(MakePairKey(pair.m_userDataA, pair.m_userDataB));
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    struct CollisionScene
+    {
+        EntityStore               m_entities;
+        std::vector<EntityHandle> m_handles;
+        float                     m_halfWorldSize = 0.f;
+    };
+
+    void FillScene(CollisionScene& scene, int entityCount, std::mt19937& rng)
+    {
+        scene.m_halfWorldSize = 0.5f * std::sqrt(AREA_PER_ENTITY * static_cast<float>(entityCount));
+        std::uniform_real_distribution<float> position(-scene.m_halfWorldSize, scene.m_halfWorldSize);
+        scene.m_entities.Reserve(entityCount);
+        for (int i = 0; i < entityCount; ++i)
+        {
+            scene.m_handles.push_back(scene.m_entities.Create(Vec3(position(rng), position(rng), 0.f)));
+        }
+    }
+
+    void AddColliders(CollisionWorld& world, const CollisionScene& scene, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> size(0.25f, 0.75f);
+        for (size_t i = 0; i < scene.m_handles.size(); ++i)
+        {
+            if (i % 2 == 0)
+            {
+                world.AddSphere(scene.m_entities, scene.m_handles[i], size(rng));
+            }
+            else
+            {
+                world.AddBox(scene.m_entities, scene.m_handles[i], Vec3(size(rng), size(rng), size(rng)));
+            }
+        }
+    }
+}
+
+void RunTest_Collision(int benchmarkMaxEntities)
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int CORRECTNESS_COUNT = 2000;
+    constexpr int FRAME_COUNT       = 10;
+
+    LogInfo("App", "=== Collision Test Starting ===");
+
+    // Correctness: both broadphases report exactly the brute-force overlapping pairs
+    std::mt19937                          rng(4321);
+    std::uniform_real_distribution<float> position(-40.f, 40.f);
+    std::uniform_real_distribution<float> size(0.1f, 2.f);
+    std::vector<CollisionBounds>          bounds(CORRECTNESS_COUNT);
+    SpatialHashGrid                       grid(Vec2(-30.f, -30.f), Vec2(30.f, 30.f), 2.f); // Smaller than the scene, exercises clamping
+    SweepAndPrune                         sweep(0);
+    std::vector<uint64_t>                 bruteForceKeys;
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; ++i)
+    {
+        Vec3 center(position(rng), position(rng), position(rng) * 0.1f);
+        Vec3 halfSize(size(rng), size(rng), size(rng));
+        bounds[i] = {center - halfSize, center + halfSize};
+        grid.AddProxy(bounds[i], i);
+        sweep.AddProxy(bounds[i], i);
+    }
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; ++i)
+    {
+        for (uint32_t j = i + 1; j < CORRECTNESS_COUNT; ++j)
+        {
+            if (bounds[i].Overlaps(bounds[j]))
+            {
+                bruteForceKeys.push_back(MakePairKey(i, j));
+            }
+        }
+    }
+    std::sort(bruteForceKeys.begin(), bruteForceKeys.end());
+    bool broadphasePassed = GetSortedPairKeys(grid) == bruteForceKeys && GetSortedPairKeys(sweep) == bruteForceKeys;
+
+    // Move and remove some proxies, then compare again
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; i += 3)
+    {
+        Vec3 offset(position(rng) * 0.05f, position(rng) * 0.05f, 0.f);
+        bounds[i] = {bounds[i].m_mins + offset, bounds[i].m_maxs + offset};
+        grid.MoveProxy(i, bounds[i]);
+        sweep.MoveProxy(i, bounds[i]);
+    }
+    for (uint32_t i = 1; i < CORRECTNESS_COUNT; i += 7)
+    {
+        grid.RemoveProxy(i);
+        sweep.RemoveProxy(i);
+    }
+    bruteForceKeys.clear();
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; ++i)
+    {
+        for (uint32_t j = i + 1; j < CORRECTNESS_COUNT; ++j)
+        {
+            if (i % 7 != 1 && j % 7 != 1 && bounds[i].Overlaps(bounds[j]))
+            {
+                bruteForceKeys.push_back(MakePairKey(i, j));
+            }
+        }
+    }
+    std::sort(bruteForceKeys.begin(), bruteForceKeys.end());
+    broadphasePassed = broadphasePassed && GetSortedPairKeys(grid) == bruteForceKeys && GetSortedPairKeys(sweep) == bruteForceKeys;
+
+    // Replace proxies the way CollisionWorld::AddCollider does, remove then add with no FindPairs()
+    // in between, and bring the removed ones back; every proxy is live again
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; ++i)
+    {
+        if (i % 7 != 1 && i % 5 != 2)
+        {
+            continue;
+        }
+        if (i % 7 != 1)
+        {
+            grid.RemoveProxy(i);
+            sweep.RemoveProxy(i);
+        }
+        Vec3 offset(position(rng) * 0.05f, 0.f, position(rng) * 0.05f);
+        bounds[i] = {bounds[i].m_mins + offset, bounds[i].m_maxs + offset};
+        grid.AddProxy(bounds[i], i);
+        sweep.AddProxy(bounds[i], i);
+    }
+    bruteForceKeys.clear();
+    for (uint32_t i = 0; i < CORRECTNESS_COUNT; ++i)
+    {
+        for (uint32_t j = i + 1; j < CORRECTNESS_COUNT; ++j)
+        {
+            if (bounds[i].Overlaps(bounds[j]))
+            {
+                bruteForceKeys.push_back(MakePairKey(i, j));
+            }
+        }
+    }
+    std::sort(bruteForceKeys.begin(), bruteForceKeys.end());
+    broadphasePassed = broadphasePassed && GetSortedPairKeys(grid) == bruteForceKeys && GetSortedPairKeys(sweep) == bruteForceKeys;
+    broadphasePassed = broadphasePassed && grid.GetProxyCount() == CORRECTNESS_COUNT && sweep.GetProxyCount() == CORRECTNESS_COUNT;
+    LogInfo("App", "Grid and sweep-and-prune against brute force, after moves, removals and re-adds (%zu pairs): %s", bruteForceKeys.size(),
+            broadphasePassed ? "PASSED" : "FAILED");
+
+    // Narrowphase: known shapes, then SSE against scalar on random pairs
+    Narrowphase narrowphase;
+    narrowphase.Add(Vec3(0, 0, 0), Vec3(), 1.f, Vec3(1.9f, 0, 0), Vec3(), 1.f);                          // Spheres touching
+    narrowphase.Add(Vec3(0, 0, 0), Vec3(), 1.f, Vec3(2.1f, 0, 0), Vec3(), 1.f);                          // Spheres apart
+    narrowphase.Add(Vec3(0, 0, 0), Vec3(), 1.f, Vec3(1.8f, 1.8f, 0), Vec3(1.f, 1.f, 1.f), 0.f);          // Sphere near a box corner, apart
+    narrowphase.Add(Vec3(0, 0, 0), Vec3(), 1.f, Vec3(1.5f, 0, 0), Vec3(1.f, 1.f, 1.f), 0.f);             // Sphere against a box face
+    narrowphase.Add(Vec3(0, 0, 0), Vec3(1.f, 1.f, 1.f), 0.f, Vec3(1.9f, 1.9f, 1.9f), Vec3(1.f, 1.f, 1.f), 0.f); // Boxes overlapping
+    std::vector<uint32_t> overlapping;
+    narrowphase.Run(overlapping);
+    bool narrowphasePassed = overlapping == std::vector<uint32_t>{0, 3, 4};
+
+    narrowphase.Clear();
+    for (int i = 0; i < 10001; ++i)
+    {
+        bool isBoxA = i % 2 == 0;
+        bool isBoxB = i % 3 == 0;
+        narrowphase.Add(Vec3(), isBoxA ? Vec3(size(rng), size(rng), size(rng)) : Vec3(), isBoxA ? 0.f : size(rng), Vec3(position(rng), position(rng), position(rng)) * 0.1f,
+                        isBoxB ? Vec3(size(rng), size(rng), size(rng)) : Vec3(), isBoxB ? 0.f : size(rng));
+    }
+    std::vector<uint32_t> scalarOverlapping;
+    narrowphase.Run(overlapping);
+    narrowphase.RunScalar(scalarOverlapping);
+    narrowphasePassed = narrowphasePassed && overlapping == scalarOverlapping;
+    LogInfo("App", "Narrowphase sphere/box tests, SSE against scalar: %s", narrowphasePassed ? "PASSED" : "FAILED");
+
+    // Throughput: one entity in ten takes a small step every frame
+    for (int entityCount : {10000, 50000, 100000})
+    {
+        if (entityCount > benchmarkMaxEntities)
+        {
+            break;
+        }
+        for (int useSweep = 0; useSweep < 2; ++useSweep)
+        {
+            std::mt19937   sceneRng(99);
+            CollisionScene scene;
+            FillScene(scene, entityCount, sceneRng);
+
+            std::unique_ptr<Broadphase> broadphase;
+            if (useSweep)
+            {
+                broadphase = std::make_unique<SweepAndPrune>(0);
+            }
+            else
+            {
+                broadphase = std::make_unique<SpatialHashGrid>(Vec2(-scene.m_halfWorldSize, -scene.m_halfWorldSize), Vec2(scene.m_halfWorldSize, scene.m_halfWorldSize), 2.f);
+            }
+            CollisionWorld world(std::move(broadphase));
+            AddColliders(world, scene, sceneRng);
+
+            std::uniform_real_distribution<float> step(-0.1f, 0.1f);
+            std::vector<EntityContact>            contacts;
+            size_t                                candidatePairs = 0;
+            size_t                                contactCount   = 0;
+            auto                                  start          = Clock::now();
+            for (int frame = 0; frame < FRAME_COUNT; ++frame)
+            {
+                for (size_t i = frame % 10; i < scene.m_handles.size(); i += 10)
+                {
+                    EntityHandle handle = scene.m_handles[i];
+                    scene.m_entities.SetPosition(handle, scene.m_entities.GetPosition(handle) + Vec3(step(sceneRng), step(sceneRng), 0.f));
+                }
+                world.Update(scene.m_entities);
+                world.FindContacts(contacts);
+                candidatePairs += world.GetCandidatePairCount();
+                contactCount += contacts.size();
+            }
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            LogInfo("App", "%6d entities, %-15s %7.3f ms/frame, %6zu candidates, %6zu contacts/frame, %.1fM pairs/s", entityCount, useSweep ? "sweep-and-prune:" : "spatial hash:",
+                    seconds * 1e3 / FRAME_COUNT, candidatePairs / FRAME_COUNT, contactCount / FRAME_COUNT, static_cast<double>(candidatePairs) / seconds * 1e-6);
+        }
+    }
+
+    LogInfo("App", "=== Collision Test Complete ===");
+}
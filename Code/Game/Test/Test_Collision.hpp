@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks the spatial hash grid and sweep-and-prune broadphases against brute force, through moves,
+// removals and same-frame remove/re-adds, and the SSE narrowphase against its scalar path. With
+// benchmarkMaxEntities > 0, also times broadphase + narrowphase at 10k, 50k and 100k entities (up
+// to that cap) with one in ten moving per frame and reports pairs per second.
+void RunTest_Collision(int benchmarkMaxEntities);
@@ -0,0 +1,6 @@
+#pragma once
+
+// Checks TypedBlackboard's int and string conversions, then benchmarks it (compile-time hashed
+// keys, values parsed once) against the string-keyed g_gameConfigBlackboard that parses text on
+// every GetValue.
+void RunTest_ConfigBlackboard();
@@ -0,0 +1,138 @@
+#include "Test_DebugShapes.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Render/DebugShapeBatcher.hpp"
+#include "Game/Render/NullRenderDevice.hpp"
+
+namespace
+{
+    /// Adds a few copies of one shape type and checks they all land, with their own indexes, in that type's batch only
+    template <typename AddShape>
+    bool CheckShapeBatch(const char* name, int batchIndex, size_t vertexesPerShape, size_t indexesPerShape, AddShape addShape)
+    {
+        using namespace enigma::core;
+
+        constexpr int SHAPE_COPIES = 3;
+
+        DebugShapeBatcher          shapes;
+        DebugShapeBatcher::Batches batches;
+        for (int i = 0; i < SHAPE_COPIES; ++i)
+        {
+            addShape(shapes, Vec3(static_cast<float>(i) * 5.f, 0.f, 0.f));
+        }
+        shapes.BuildBatches(batches);
+
+        bool passed = vertexesPerShape > 0 && indexesPerShape > 0;
+        for (int batch = 0; batch < DebugShapeBatcher::BATCH_COUNT; ++batch)
+        {
+            size_t copies = batch == batchIndex ? SHAPE_COPIES : 0;
+            passed        = passed && batches[batch].m_vertexes.size() == vertexesPerShape * copies && batches[batch].m_indexes.size() == indexesPerShape * copies;
+        }
+        const std::vector<unsigned int>& indexes = batches[batchIndex].m_indexes;
+        for (size_t i = 0; passed && i < indexes.size(); ++i)
+        {
+            size_t copy = i / indexesPerShape;
+            passed      = indexes[i] >= copy * vertexesPerShape && indexes[i] < (copy + 1) * vertexesPerShape;
+        }
+        shapes.Clear();
+
+        LogInfo("App", "%s: %zu vertexes, %zu indexes per shape: %s", name, vertexesPerShape, indexesPerShape, passed ? "PASSED" : "FAILED");
+        return passed;
+    }
+}
+
+void RunTest_DebugShapes()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int    FRAME_COUNT      = 120;
+    constexpr int    SPAWNS_PER_FRAME = 40; // Holding '2' spawns one sphere per frame, this is 40x that
+    constexpr double FRAME_SECONDS    = 1.0 / 60.0;
+
+    LogInfo("App", "=== Debug Shape Batcher Stress Test Starting ===");
+
+    // Correctness: expected tessellation per shape type, each type in its own batch
+    {
+        constexpr size_t SLICES          = DebugShapeBatcher::SPHERE_SLICES;
+        constexpr size_t STACKS          = DebugShapeBatcher::SPHERE_STACKS;
+        constexpr size_t SPHERE_VERTEXES = (SLICES + 1) * (STACKS + 1);
+        constexpr size_t SPHERE_INDEXES  = (SLICES * STACKS * 2 - SLICES * 2) * 3; // Quads touching a pole are one triangle
+
+        // Cylinders are unindexed, one index per vertex of the engine tessellation
+        std::vector<Vertex_PCU> cylinderVerts;
+        AddVertsForCylinder3D(cylinderVerts, Vec3(), Vec3(0, 0, 1), 0.5f);
+
+        CheckShapeBatch("Sphere", DebugShapeBatcher::GetBatchIndex(DebugRenderMode::USE_DEPTH, false), SPHERE_VERTEXES, SPHERE_INDEXES,
+                        [](DebugShapeBatcher& shapes, const Vec3& position)
+                        {
+                            shapes.AddWorldSphere(position, 0.25f, -1.f, Rgba8::WHITE, Rgba8::RED);
+                        });
+        CheckShapeBatch("Wire sphere", DebugShapeBatcher::GetBatchIndex(DebugRenderMode::USE_DEPTH, true), SPHERE_VERTEXES, SPHERE_INDEXES,
+                        [](DebugShapeBatcher& shapes, const Vec3& position)
+                        {
+                            shapes.AddWorldWireSphere(position, 1.f, -1.f, Rgba8::GREEN, Rgba8::RED);
+                        });
+        CheckShapeBatch("X-ray cylinder", DebugShapeBatcher::GetBatchIndex(DebugRenderMode::X_RAY, false), cylinderVerts.size(), cylinderVerts.size(),
+                        [](DebugShapeBatcher& shapes, const Vec3& position)
+                        {
+                            shapes.AddWorldCylinder(position, position + Vec3(0, 0, 1), 0.5f, -1.f, Rgba8::WHITE, Rgba8::RED, DebugRenderMode::X_RAY);
+                        });
+    }
+
+    NullRenderDevice      nullDevice;
+    RenderDevice*         previousDevice = g_theRenderDevice;
+    g_theRenderDevice                    = &nullDevice;
+    RandomNumberGenerator rng;
+    DebugShapeBatcher     shapes;
+
+    double totalSeconds = 0.0;
+    int    peakLive     = 0;
+    int    totalDraws   = 0;
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        auto frameStart = Clock::now();
+        nullDevice.BeginFrame();
+        shapes.BeginFrame(frame * FRAME_SECONDS);
+        for (int i = 0; i < SPAWNS_PER_FRAME; ++i)
+        {
+            Vec3  position(rng.RollRandomFloatInRange(-50.f, 50.f), rng.RollRandomFloatInRange(-50.f, 50.f), 0.f);
+            float duration = rng.RollRandomFloatInRange(0.f, 3.f);
+            switch (i % 4)
+            {
+            case 0:
+                shapes.AddWorldSphere(position, 0.25f, duration, Rgba8::WHITE, Rgba8::RED);
+                break;
+            case 1:
+                shapes.AddWorldWireSphere(position, 1.f, duration, Rgba8::GREEN, Rgba8::RED);
+                break;
+            case 2:
+                shapes.AddWorldCylinder(position, position + Vec3(0, 0, 1), 0.5f, duration, Rgba8::WHITE, Rgba8::RED, DebugRenderMode::X_RAY);
+                break;
+            default:
+                shapes.AddWorldSphere(position, 0.5f, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+                break;
+            }
+        }
+        shapes.Render();
+        totalSeconds += std::chrono::duration<double>(Clock::now() - frameStart).count();
+
+        peakLive = shapes.GetLiveShapeCount() > peakLive ? shapes.GetLiveShapeCount() : peakLive;
+        totalDraws += nullDevice.GetFrameStats().m_drawCalls;
+    }
+
+    LogInfo("App", "Frame cost: %.3f ms (expire + spawn %d + merge + draw)", totalSeconds * 1e3 / FRAME_COUNT, SPAWNS_PER_FRAME);
+    LogInfo("App", "Peak live shapes: %d, pooled records: %d", peakLive, shapes.GetPooledShapeCount());
+    LogInfo("App", "Draw calls: %.1f/frame", static_cast<double>(totalDraws) / FRAME_COUNT);
+
+    shapes.Clear();
+    g_theRenderDevice = previousDevice;
+
+    LogInfo("App", "=== Debug Shape Batcher Stress Test Complete ===");
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Checks DebugShapeBatcher's vertex and index counts per shape type and that each type is merged
+// into its own batch, then spawns shapes with mixed lifetimes every simulated frame and logs frame
+// cost, draws per frame and pool growth against a NullRenderDevice.
+void RunTest_DebugShapes();
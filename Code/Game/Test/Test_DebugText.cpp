@@ -0,0 +1,68 @@
+#include "Test_DebugText.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Render/DebugTextRenderer.hpp"
+#include "Game/Render/NullRenderDevice.hpp"
+
+void RunTest_DebugText()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int LABEL_COUNT = 500;
+    constexpr int FRAME_COUNT = 120;
+
+    LogInfo("App", "=== Debug Text Cache Test Starting ===");
+
+    NullRenderDevice  nullDevice;
+    RenderDevice*     previousDevice = g_theRenderDevice;
+    g_theRenderDevice                = &nullDevice;
+    DebugTextRenderer text;
+    text.SetFont(g_theRenderer ? g_theRenderer->CreateOrGetBitmapFont(DEBUG_TEXT_FONT_PATH) : nullptr, DEBUG_TEXT_FONT_ASPECT);
+
+    // Labels cycle through 50 distinct strings, so ten labels share every layout
+    std::vector<DebugTextHandle> labels;
+    char                         buffer[64];
+    for (int i = 0; i < LABEL_COUNT; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), "Label %d", i % 50);
+        labels.push_back(text.AddScreenText(buffer, Vec2(0.f, static_cast<float>(i)), 14.f));
+    }
+    DebugTextHandle counter       = text.AddScreenText("", Vec2::ZERO, 14.f);
+    uint64_t        initialBuilds = text.GetLayoutBuildCount();
+
+    auto start = Clock::now();
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        nullDevice.BeginFrame();
+        text.BeginFrame(frame / 60.0);
+        for (int i = 0; i < LABEL_COUNT; ++i)
+        {
+            std::snprintf(buffer, sizeof(buffer), "Label %d", i % 50);
+            text.SetText(labels[i], buffer);
+        }
+        std::snprintf(buffer, sizeof(buffer), "Frame %d", frame);
+        text.SetText(counter, buffer);
+        text.RenderScreen();
+    }
+    double frameMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+
+    uint64_t frameBuilds = text.GetLayoutBuildCount() - initialBuilds;
+    LogInfo("App", "%d labels: %llu initial layouts, %d cached", LABEL_COUNT, static_cast<unsigned long long>(initialBuilds), text.GetCachedLayoutCount());
+    LogInfo("App", "%d frames: %llu layouts rebuilt for %d SetText calls, %.3f ms/frame", FRAME_COUNT, static_cast<unsigned long long>(frameBuilds),
+            FRAME_COUNT * (LABEL_COUNT + 1), frameMs);
+    if (initialBuilds != 51 || frameBuilds != FRAME_COUNT)
+    {
+        LogError("App", "Layout cache rebuilt unchanged text (expected 51 initial and %d frame builds)", FRAME_COUNT);
+    }
+
+    g_theRenderDevice = previousDevice;
+
+    LogInfo("App", "=== Debug Text Cache Test Complete ===");
+}
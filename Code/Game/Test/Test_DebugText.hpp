@@ -0,0 +1,5 @@
+#pragma once
+
+// Exercises DebugTextRenderer's layout cache: many labels re-set to unchanged text, shared strings
+// and a per-frame counter, logging how many layouts were built against how many texts were set.
+void RunTest_DebugText();
@@ -0,0 +1,196 @@
+#include "Test_EntityStore.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/EntityStore.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Render/RenderDevice.hpp"
+
+void RunTest_EntityStore(int benchmarkEntities)
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int   FRAME_COUNT   = 60;
+    constexpr float DELTA_SECONDS = 1.f / 60.f;
+
+    LogInfo("App", "=== Entity Store Test Starting ===");
+
+    // Correctness: stale handles, swap-removal keeps survivors addressable, reused slots get a new generation
+    EntityStore  store;
+    EntityHandle first  = store.Create(Vec3(1, 0, 0));
+    EntityHandle second = store.Create(Vec3(2, 0, 0));
+    EntityHandle third  = store.Create(Vec3(3, 0, 0));
+    store.Destroy(first);
+    bool passed = !store.IsAlive(first) && store.GetCount() == 2;
+    passed      = passed && store.GetPosition(second).x == 2.f && store.GetPosition(third).x == 3.f;
+
+    EntityHandle reused = store.Create(Vec3(4, 0, 0));
+    passed              = passed && reused.m_index == first.m_index && reused != first && !store.IsAlive(first);
+    store.SetPosition(first, Vec3(99, 0, 0)); // Stale, must not touch the entity now in that slot
+    passed = passed && store.GetPosition(reused).x == 4.f;
+
+    store.SetVelocity(third, Vec3(0, 0, 2));
+    store.Integrate(0.5f);
+    store.UpdateWorldTransforms();
+    Vec3 thirdWorld = store.GetWorldTransforms()[store.GetDenseIndex(third)].TransformPosition3D(Vec3());
+    passed          = passed && thirdWorld.x == 3.f && thirdWorld.z == 1.f;
+    store.Clear();
+    passed = passed && !store.IsAlive(second) && store.GetCount() == 0;
+    LogInfo("App", "Handles, generations and swap-removal: %s", passed ? "PASSED" : "FAILED");
+
+    // Deferred death: stale at once, compacted by CollectDead() with the survivors kept in order
+    for (int i = 0; i < 6; ++i)
+    {
+        store.Create(Vec3(static_cast<float>(i), 0, 0));
+    }
+    EntityHandle doomed    = store.GetHandle(1);
+    EntityHandle doomedToo = store.GetHandle(3);
+    EntityHandle survivor  = store.GetHandle(4);
+    store.Kill(doomed);
+    store.Kill(doomedToo);
+    store.Kill(doomed); // Already stale, must not count twice
+    passed = !store.IsAlive(doomed) && store.GetCount() == 6 && store.GetDeadCount() == 2 && !store.GetHandle(1).IsValid();
+    passed = passed && store.CollectDead() == 2 && store.GetCount() == 4 && store.GetDeadCount() == 0;
+    passed = passed && store.GetPosition(survivor).x == 4.f && store.GetDenseIndex(survivor) == 2 && store.GetPositions().m_x[1] == 2.f;
+    EntityHandle recycled = store.Create(); // Takes a collected slot under a new generation
+    passed                = passed && recycled.m_index == doomedToo.m_index && recycled != doomedToo && !store.IsAlive(doomedToo);
+    store.Clear();
+    LogInfo("App", "Deferred kill and batched collection: %s", passed ? "PASSED" : "FAILED");
+
+    // Interpolation: a mover blends between its last two steps, settles once it stops, teleports snap
+    EntityHandle mover = store.Create(Vec3(0, 0, 0));
+    store.SetVelocity(mover, Vec3(2, 0, 0));
+    store.Integrate(1.f);
+    store.UpdateWorldTransforms(0.25f);
+    uint32_t moverIndex = store.GetDenseIndex(mover);
+    passed              = store.GetWorldTransforms()[moverIndex].TransformPosition3D(Vec3()).x == 0.5f;
+    store.UpdateWorldTransforms(0.75f);
+    passed = passed && store.GetWorldTransforms()[moverIndex].TransformPosition3D(Vec3()).x == 1.5f;
+    store.SetVelocity(mover, Vec3());
+    store.Integrate(1.f);
+    store.UpdateWorldTransforms(0.25f);
+    passed = passed && store.GetWorldTransforms()[moverIndex].TransformPosition3D(Vec3()).x == 2.f && (store.GetFlags()[moverIndex] & EntityStore::FLAG_TRANSFORM_DIRTY) == 0;
+    store.SetVelocity(mover, Vec3(2, 0, 0));
+    store.Integrate(1.f);
+    store.SetPosition(mover, Vec3(10, 0, 0));
+    store.UpdateWorldTransforms(0.5f);
+    passed = passed && store.GetWorldTransforms()[moverIndex].TransformPosition3D(Vec3()).x == 10.f;
+    store.Clear();
+    LogInfo("App", "Fixed-step interpolation: %s", passed ? "PASSED" : "FAILED");
+
+    // Burst despawn: half of the entities die in one frame, scattered through the columns
+    if (benchmarkEntities > 0)
+    {
+        const int BURST_COUNT = benchmarkEntities / 2;
+
+        EntityStore               burst;
+        std::vector<EntityHandle> handles;
+        handles.reserve(benchmarkEntities);
+        burst.Reserve(benchmarkEntities);
+        for (int i = 0; i < benchmarkEntities; ++i)
+        {
+            handles.push_back(burst.Create(Vec3(static_cast<float>(i), 0.f, 0.f)));
+        }
+
+        auto burstStart = Clock::now();
+        for (int i = 0; i < BURST_COUNT; ++i)
+        {
+            burst.Destroy(handles[i * 2]);
+        }
+        double destroyMs = std::chrono::duration<double, std::milli>(Clock::now() - burstStart).count();
+
+        burst.Clear();
+        handles.clear();
+        for (int i = 0; i < benchmarkEntities; ++i)
+        {
+            handles.push_back(burst.Create(Vec3(static_cast<float>(i), 0.f, 0.f)));
+        }
+
+        burstStart = Clock::now();
+        for (int i = 0; i < BURST_COUNT; ++i)
+        {
+            burst.Kill(handles[i * 2]);
+        }
+        size_t collected = burst.CollectDead();
+        double collectMs = std::chrono::duration<double, std::milli>(Clock::now() - burstStart).count();
+
+        LogInfo("App", "%d of %d entities despawned: Destroy each %.3f ms, Kill + CollectDead %.3f ms (%zu collected)", BURST_COUNT, benchmarkEntities, destroyMs, collectMs,
+                collected);
+    }
+
+    // Throughput: one entity in eight moves and spins, then every transform and tint is gathered into instances
+    if (benchmarkEntities > 0)
+    {
+        store.Reserve(benchmarkEntities);
+        std::vector<std::unique_ptr<Prop>> props;
+        props.reserve(benchmarkEntities);
+        for (int i = 0; i < benchmarkEntities; ++i)
+        {
+            Vec3        position(static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.f);
+            bool        isMover = (i % 8) == 0;
+            Vec3        velocity(0.f, 0.f, isMover ? 0.5f : 0.f);
+            EulerAngles spin(isMover ? 45.f : 0.f, 0.f, 0.f);
+
+            EntityHandle handle = store.Create(position, 0);
+            store.SetVelocity(handle, velocity);
+            store.SetAngularVelocity(handle, spin);
+
+            props.push_back(std::make_unique<Prop>(nullptr));
+            props.back()->SetPosition(position);
+            props.back()->m_velocity        = velocity;
+            props.back()->m_angularVelocity = spin;
+        }
+
+        std::vector<MeshInstance> instances;
+        instances.reserve(benchmarkEntities);
+        float checksum = 0.f;
+
+        auto start = Clock::now();
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            store.Integrate(DELTA_SECONDS);
+            store.UpdateWorldTransforms();
+            instances.clear();
+            const std::pmr::vector<Mat44>& worldTransforms = store.GetWorldTransforms();
+            const std::pmr::vector<Rgba8>& colors          = store.GetColors();
+            for (size_t i = 0; i < store.GetCount(); ++i)
+            {
+                MeshInstance instance;
+                instance.m_modelToWorldTransform = worldTransforms[i];
+                instance.m_tint                  = colors[i];
+                instances.push_back(instance);
+            }
+            checksum += instances.front().m_modelToWorldTransform.TransformPosition3D(Vec3()).z;
+        }
+        double storeMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+
+        start = Clock::now();
+        for (int frame = 0; frame < FRAME_COUNT; ++frame)
+        {
+            instances.clear();
+            for (const std::unique_ptr<Prop>& prop : props)
+            {
+                prop->Update(DELTA_SECONDS);
+                prop->SetPosition(prop->GetPosition() + prop->m_velocity * DELTA_SECONDS);
+                MeshInstance instance;
+                instance.m_modelToWorldTransform = prop->GetModelToWorldTransform();
+                instance.m_tint                  = prop->m_color;
+                instances.push_back(instance);
+            }
+            checksum += instances.front().m_modelToWorldTransform.TransformPosition3D(Vec3()).z;
+        }
+        double propMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+
+        LogInfo("App", "%d entities integrate + gather: store %.3f ms, heap props %.3f ms per frame (checksum %.1f)", benchmarkEntities, storeMs, propMs,
+                static_cast<double>(checksum));
+    }
+
+    LogInfo("App", "=== Entity Store Test Complete ===");
+}
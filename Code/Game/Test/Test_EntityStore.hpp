@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks EntityStore handle generations, swap-removal, deferred kills and step interpolation.
+// When benchmarkEntities > 0, also times despawning half of that many entities in one burst
+// through Destroy() against Kill() + CollectDead(), and integrating and gathering that many
+// moving entities from SoA columns against the same work on individually allocated Props.
+void RunTest_EntityStore(int benchmarkEntities);
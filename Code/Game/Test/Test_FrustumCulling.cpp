@@ -0,0 +1,86 @@
+#include "Test_FrustumCulling.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Player.hpp"
+#include "Game/Render/BoundingVolume.hpp"
+#include "Game/Render/Frustum.hpp"
+#include "Game/Render/FrustumCuller.hpp"
+
+namespace
+{
+    BoundingVolume MakeCube(const Vec3& center, float halfSize)
+    {
+        BoundingVolume bounds;
+        bounds.m_center      = center;
+        bounds.m_halfExtents = Vec3(halfSize, halfSize, halfSize);
+        bounds.m_radius      = halfSize * 1.7320508f;
+        return bounds;
+    }
+}
+
+void RunTest_FrustumCulling()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int   BOUNDS_COUNT = 100000;
+    constexpr int   ITERATIONS   = 20;
+    constexpr float SCENE_EXTENT = 200.f;
+
+    LogInfo("App", "=== Frustum Culling Test Starting ===");
+
+    // Camera at the origin looking down +X, the player's default view
+    Frustum frustum = Frustum::MakePerspective(Vec3(0, 0, 0), EulerAngles(), Player::CAMERA_ASPECT, Player::CAMERA_FOV_DEGREES, Player::CAMERA_NEAR_DISTANCE,
+                                               Player::CAMERA_FAR_DISTANCE);
+    bool knownPointsPass = frustum.IsVisible(MakeCube(Vec3(10, 0, 0), 0.5f)) &&  // Straight ahead
+        !frustum.IsVisible(MakeCube(Vec3(-10, 0, 0), 0.5f)) &&                  // Behind
+        !frustum.IsVisible(MakeCube(Vec3(150, 0, 0), 0.5f)) &&                  // Past the far plane
+        !frustum.IsVisible(MakeCube(Vec3(10, 40, 0), 0.5f)) &&                  // Far to the left
+        frustum.IsVisible(MakeCube(Vec3(10, 0, 6), 0.5f)) &&                    // Inside the 30 degree half-height
+        !frustum.IsVisible(MakeCube(Vec3(10, 0, 8), 0.5f)) &&                   // Above it
+        frustum.IsVisible(MakeCube(Vec3(0, 0, 0), 1.f));                        // Straddles the near plane
+
+    std::mt19937                          rng(1234);
+    std::uniform_real_distribution<float> position(-SCENE_EXTENT, SCENE_EXTENT);
+    std::uniform_real_distribution<float> size(0.25f, 4.f);
+    FrustumCuller                         culler;
+    culler.Reserve(BOUNDS_COUNT);
+    for (int i = 0; i < BOUNDS_COUNT; ++i)
+    {
+        culler.Add(MakeCube(Vec3(position(rng), position(rng), position(rng) * 0.1f), size(rng)));
+    }
+
+    std::vector<uint32_t> batchedVisible;
+    std::vector<uint32_t> scalarVisible;
+    auto                  batchedStart = Clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        culler.Cull(frustum, batchedVisible);
+    }
+    auto scalarStart = Clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        culler.CullScalar(frustum, scalarVisible);
+    }
+    auto scalarEnd = Clock::now();
+
+    double batchedMs = std::chrono::duration<double, std::milli>(scalarStart - batchedStart).count() / ITERATIONS;
+    double scalarMs  = std::chrono::duration<double, std::milli>(scalarEnd - scalarStart).count() / ITERATIONS;
+
+    LogInfo("App", "Known points: %s", knownPointsPass ? "PASSED" : "FAILED");
+    LogInfo("App", "%d bounds: %zu visible (%.1f%%)", BOUNDS_COUNT, batchedVisible.size(), 100.0 * static_cast<double>(batchedVisible.size()) / BOUNDS_COUNT);
+    LogInfo("App", "Batched: %.3f ms, scalar: %.3f ms (%.2fx)", batchedMs, scalarMs, batchedMs > 0.0 ? scalarMs / batchedMs : 0.0);
+    if (!knownPointsPass || batchedVisible != scalarVisible)
+    {
+        LogError("App", "Frustum culling disagrees with %s", knownPointsPass ? "the scalar reference" : "known points");
+    }
+
+    LogInfo("App", "=== Frustum Culling Test Complete ===");
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Checks the frustum planes against a few known points and compares FrustumCuller's SSE path
+// with its scalar reference over a large random scene, logging visible counts and timings.
+void RunTest_FrustumCulling();
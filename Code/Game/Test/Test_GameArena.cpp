@@ -0,0 +1,169 @@
+#include "Test_GameArena.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Collision/SpatialHashGrid.hpp"
+#include "Game/EntityStore.hpp"
+#include "Game/Framework/GameArena.hpp"
+
+namespace
+{
+    constexpr int   MESH_COUNT      = 2000;
+    constexpr int   ENTITY_COUNT    = 100000;
+    constexpr float HALF_WORLD_SIZE = 250.f;
+
+    struct TestMesh
+    {
+        explicit TestMesh(std::pmr::memory_resource* memory)
+            : m_vertexes(memory), m_indexes(memory)
+        {
+        }
+
+        std::pmr::vector<Vertex_PCU>   m_vertexes;
+        std::pmr::vector<unsigned int> m_indexes;
+    };
+
+    /// Everything a game with many props and entities owns, all drawing from one memory resource
+    struct TestWorld
+    {
+        explicit TestWorld(std::pmr::memory_resource* memory)
+            : m_meshes(memory)
+            , m_entities(memory)
+            , m_grid(Vec2(-HALF_WORLD_SIZE, -HALF_WORLD_SIZE), Vec2(HALF_WORLD_SIZE, HALF_WORLD_SIZE), 2.f, memory)
+        {
+            m_meshes.reserve(MESH_COUNT);
+            for (int i = 0; i < MESH_COUNT; ++i)
+            {
+                // Cube to sphere sized vertex arrays, each its own allocation
+                m_meshes.emplace_back(memory);
+                m_meshes.back().m_vertexes.resize(24 + (i % 64) * 32);
+                m_meshes.back().m_indexes.resize(36 + (i % 64) * 48);
+            }
+
+            m_entities.Reserve(ENTITY_COUNT);
+            for (int i = 0; i < ENTITY_COUNT; ++i)
+            {
+                Vec3 position(static_cast<float>(i % 500) - HALF_WORLD_SIZE, static_cast<float>(i / 500 % 500) - HALF_WORLD_SIZE, 0.f);
+                m_entities.Create(position);
+                if (i % 4 == 0)
+                {
+                    m_grid.AddProxy({position, position + Vec3(1.f, 1.f, 1.f)}, static_cast<uint32_t>(i));
+                }
+            }
+        }
+
+        std::pmr::vector<TestMesh> m_meshes;
+        EntityStore                m_entities;
+        SpatialHashGrid            m_grid;
+    };
+
+    struct RestartTimes
+    {
+        double m_teardownMs = 0.0;
+        double m_rebuildMs  = 0.0;
+    };
+}
+
+void RunTest_GameArena(int benchmarkRestarts)
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    LogInfo("App", "=== Game Arena Test Starting ===");
+
+    // Correctness: alignment honored, reset rewinds without giving blocks back, oversized requests get their own block
+    {
+        struct alignas(64) CacheLine
+        {
+            float m_values[16];
+        };
+
+        GameArena  arena(4096);
+        char*      byte      = arena.New<char>('a');
+        CacheLine* cacheLine = arena.New<CacheLine>();
+        bool       passed    = *byte == 'a' && reinterpret_cast<uintptr_t>(cacheLine) % alignof(CacheLine) == 0;
+
+        void* large = arena.allocate(10000, 16);
+        passed      = passed && large != nullptr && arena.GetBlockCount() == 2 && arena.GetAllocationCount() == 3;
+
+        size_t reserved = arena.GetBytesReserved();
+        arena.Reset();
+        passed = passed && arena.GetBytesAllocated() == 0 && arena.GetBytesReserved() == reserved;
+
+        // The same sequence after a reset lands in the kept blocks
+        arena.New<char>('b');
+        arena.New<CacheLine>();
+        large  = arena.allocate(10000, 16);
+        passed = passed && large != nullptr && arena.GetBlockCount() == 2 && arena.GetBytesReserved() == reserved;
+        LogInfo("App", "Alignment, reset and block reuse: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Correctness: Delete + Reset + New rebuilds an object and its container storage in the kept blocks
+    {
+        GameArena              arena(4096);
+        std::pmr::vector<int>* values = arena.New<std::pmr::vector<int>>(&arena);
+        values->resize(10000, 1);
+        size_t warmBlocks = arena.GetBlockCount();
+
+        arena.Delete(values);
+        arena.Reset();
+        values = arena.New<std::pmr::vector<int>>(&arena);
+        values->resize(10000, 2);
+        bool passed = arena.GetBlockCount() == warmBlocks && arena.GetBytesReserved() > arena.GetBytesAllocated() && (*values)[9999] == 2;
+        arena.Delete(values);
+        LogInfo("App", "Rebuild after reset allocates no new blocks: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Restart latency: destroy and rebuild the whole world, heap against arena
+    if (benchmarkRestarts > 0)
+    {
+        RestartTimes heapTimes;
+        {
+            TestWorld* world = new TestWorld(std::pmr::new_delete_resource());
+            for (int restart = 0; restart < benchmarkRestarts; ++restart)
+            {
+                auto start = Clock::now();
+                delete world;
+                auto middle = Clock::now();
+                world       = new TestWorld(std::pmr::new_delete_resource());
+                heapTimes.m_teardownMs += std::chrono::duration<double, std::milli>(middle - start).count() / benchmarkRestarts;
+                heapTimes.m_rebuildMs += std::chrono::duration<double, std::milli>(Clock::now() - middle).count() / benchmarkRestarts;
+            }
+            delete world;
+        }
+
+        RestartTimes arenaTimes;
+        size_t       arenaAllocations = 0;
+        size_t       arenaBlocks      = 0;
+        {
+            GameArena  arena;
+            TestWorld* world = arena.New<TestWorld>(&arena);
+            for (int restart = 0; restart < benchmarkRestarts; ++restart)
+            {
+                auto start = Clock::now();
+                arena.Delete(world);
+                arena.Reset();
+                auto middle = Clock::now();
+                world       = arena.New<TestWorld>(&arena);
+                arenaTimes.m_teardownMs += std::chrono::duration<double, std::milli>(middle - start).count() / benchmarkRestarts;
+                arenaTimes.m_rebuildMs += std::chrono::duration<double, std::milli>(Clock::now() - middle).count() / benchmarkRestarts;
+            }
+            arenaAllocations = arena.GetAllocationCount();
+            arenaBlocks      = arena.GetBlockCount();
+            arena.Delete(world);
+        }
+
+        LogInfo("App", "Restart with %d meshes, %d entities, %zu allocations (%zu arena blocks):", MESH_COUNT, ENTITY_COUNT, arenaAllocations, arenaBlocks);
+        LogInfo("App", "  heap:  teardown %7.3f ms, rebuild %7.3f ms", heapTimes.m_teardownMs, heapTimes.m_rebuildMs);
+        LogInfo("App", "  arena: teardown %7.3f ms, rebuild %7.3f ms", arenaTimes.m_teardownMs, arenaTimes.m_rebuildMs);
+    }
+
+    LogInfo("App", "=== Game Arena Test Complete ===");
+}
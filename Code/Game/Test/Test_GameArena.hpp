@@ -0,0 +1,8 @@
+#pragma once
+
+// Checks GameArena alignment, reset, block reuse and Delete/Reset/New rebuilds. When
+// benchmarkRestarts > 0, also times that many teardowns and rebuilds of a synthetic game-sized
+// population (mesh vertex arrays, 100k entities, a collision grid) on the heap against the same
+// population on an arena that is reset instead of freed. The real Game's restart is measured by
+// RunTest_HeadlessRender.
+void RunTest_GameArena(int benchmarkRestarts);
@@ -0,0 +1,214 @@
+#include "Test_GameEventBus.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Game/GameEvents.hpp"
+#include "Game/Framework/GameEventBus.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+
+namespace
+{
+    constexpr int BENCHMARK_FIRES  = 1000000;
+    constexpr int QUEUED_HIT_COUNT = 100;
+
+    /// Callbacks are free functions, so the state they act on lives here
+    struct ReentrancyState
+    {
+        GameEventBus*     m_bus              = nullptr;
+        EventSubscription m_self;
+        EventSubscription m_later;
+        int               m_firstCalls       = 0;
+        int               m_lateJoinerCalls  = 0;
+        int               m_laterCalls       = 0;
+        int               m_nestedFireDepth  = 0;
+        uint32_t          m_lastQueuedIndex  = 0;
+        bool              m_queuedInOrder    = true;
+    };
+
+    ReentrancyState g_state;
+
+    bool OnHitLateJoiner(const EntityHitEvent&)
+    {
+        ++g_state.m_lateJoinerCalls;
+        return false;
+    }
+
+    bool OnHitSubscribesLateJoiner(const EntityHitEvent&)
+    {
+        ++g_state.m_firstCalls;
+        if (g_state.m_firstCalls == 1)
+        {
+            g_state.m_bus->Subscribe<EntityHitEvent>(&OnHitLateJoiner);
+        }
+        return false;
+    }
+
+    bool OnHitUnsubscribesSelf(const EntityHitEvent&)
+    {
+        ++g_state.m_firstCalls;
+        g_state.m_bus->Unsubscribe(g_state.m_self);
+        return false;
+    }
+
+    bool OnHitUnsubscribesLater(const EntityHitEvent&)
+    {
+        ++g_state.m_firstCalls;
+        g_state.m_bus->Unsubscribe(g_state.m_later);
+        return false;
+    }
+
+    bool OnHitLater(const EntityHitEvent&)
+    {
+        ++g_state.m_laterCalls;
+        return false;
+    }
+
+    /// Fires the same event again from inside its own dispatch and unsubscribes on the way out
+    bool OnHitFiresNested(const EntityHitEvent& event)
+    {
+        ++g_state.m_firstCalls;
+        if (g_state.m_nestedFireDepth == 0)
+        {
+            ++g_state.m_nestedFireDepth;
+            g_state.m_bus->Fire(event);
+            --g_state.m_nestedFireDepth;
+            g_state.m_bus->Unsubscribe(g_state.m_self);
+        }
+        return false;
+    }
+
+    bool OnHitConsumes(const EntityHitEvent&)
+    {
+        ++g_state.m_firstCalls;
+        return true;
+    }
+
+    bool OnHitCountsOnly(const EntityHitEvent&)
+    {
+        return false;
+    }
+
+    bool OnQueuedHit(const EntityHitEvent& event)
+    {
+        g_state.m_queuedInOrder   = g_state.m_queuedInOrder && event.m_target.m_index == g_state.m_lastQueuedIndex;
+        g_state.m_lastQueuedIndex = event.m_target.m_index + 1;
+        return false;
+    }
+
+    void ResetState(GameEventBus& bus)
+    {
+        bus.Clear();
+        g_state       = ReentrancyState();
+        g_state.m_bus = &bus;
+    }
+}
+
+void RunTest_GameEventBus()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    LogInfo("App", "=== Game Event Bus Test Starting ===");
+
+    GameEventBus         bus;
+    const EntityHitEvent hit{EntityHandle{1, 0}, EntityHandle{2, 0}};
+
+    // Subscribing from a callback: the new subscriber only sees the next Fire
+    {
+        ResetState(bus);
+        bus.Subscribe<EntityHitEvent>(&OnHitSubscribesLateJoiner);
+        int  delivered = bus.Fire(hit);
+        bool passed    = delivered == 1 && g_state.m_lateJoinerCalls == 0 && bus.GetSubscriberCount(EntityHitEvent::ID) == 2;
+        delivered      = bus.Fire(hit);
+        passed         = passed && delivered == 2 && g_state.m_lateJoinerCalls == 1;
+        LogInfo("App", "Subscribe during dispatch: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Unsubscribing from a callback: itself, or a subscriber later in the same list
+    {
+        ResetState(bus);
+        g_state.m_self = bus.Subscribe<EntityHitEvent>(&OnHitUnsubscribesSelf);
+        bus.Subscribe<EntityHitEvent>(&OnHitLater);
+        bus.Fire(hit);
+        bus.Fire(hit);
+        bool passed = g_state.m_firstCalls == 1 && g_state.m_laterCalls == 2 && !g_state.m_self.IsValid();
+        passed      = passed && bus.GetSubscriberCount(EntityHitEvent::ID) == 1;
+
+        ResetState(bus);
+        bus.Subscribe<EntityHitEvent>(&OnHitUnsubscribesLater);
+        g_state.m_later = bus.Subscribe<EntityHitEvent>(&OnHitLater);
+        int delivered   = bus.Fire(hit);
+        passed          = passed && delivered == 1 && g_state.m_laterCalls == 0 && bus.GetSubscriberCount(EntityHitEvent::ID) == 1;
+        LogInfo("App", "Unsubscribe during dispatch: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Firing the same event from inside its dispatch, then unsubscribing while the outer walk is live
+    {
+        ResetState(bus);
+        g_state.m_self = bus.Subscribe<EntityHitEvent>(&OnHitFiresNested);
+        bus.Subscribe<EntityHitEvent>(&OnHitLater);
+        int  delivered = bus.Fire(hit);
+        bool passed    = delivered == 2 && g_state.m_firstCalls == 2 && g_state.m_laterCalls == 2;
+        passed         = passed && bus.GetSubscriberCount(EntityHitEvent::ID) == 1 && bus.Fire(hit) == 1;
+        LogInfo("App", "Nested fire: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // A consuming callback stops delivery
+    {
+        ResetState(bus);
+        bus.Subscribe<EntityHitEvent>(&OnHitConsumes);
+        bus.Subscribe<EntityHitEvent>(&OnHitLater);
+        bool passed = bus.Fire(hit) == 1 && g_state.m_laterCalls == 0;
+        LogInfo("App", "Consumed events stop: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Worker thread queues, main thread delivers in queue order
+    {
+        ResetState(bus);
+        bus.Subscribe<EntityHitEvent>(&OnQueuedHit);
+        std::thread producer([&bus]()
+        {
+            for (uint32_t i = 0; i < QUEUED_HIT_COUNT; ++i)
+            {
+                bus.QueueEvent(EntityHitEvent{EntityHandle{i, 0}, EntityHandle{}});
+            }
+        });
+        producer.join();
+        int  delivered = bus.DispatchQueuedEvents();
+        bool passed    = delivered == QUEUED_HIT_COUNT && g_state.m_queuedInOrder && bus.GetDroppedEventCount() == 0;
+        LogInfo("App", "Queued events from a worker: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Steady state: a Fire with subscribers in place never touches the heap
+    ResetState(bus);
+    for (int i = 0; i < 4; ++i)
+    {
+        bus.Subscribe<EntityHitEvent>(&OnHitCountsOnly);
+    }
+    bus.Fire(hit);
+#if GAME_MEMORY_TRACKING_ENABLED
+    {
+        uint64_t allocationsBefore = MemoryTracker::GetTotalStats().m_totalAllocations;
+        for (int i = 0; i < 1000; ++i)
+        {
+            bus.Fire(EntityHitEvent{EntityHandle{static_cast<uint32_t>(i), 0}, EntityHandle{}});
+            bus.Fire(EntitySpawnedEvent{EntityHandle{static_cast<uint32_t>(i), 0}, Vec3()});
+        }
+        bool passed = MemoryTracker::GetTotalStats().m_totalAllocations == allocationsBefore;
+        LogInfo("App", "Fire allocates nothing: %s", passed ? "PASSED" : "FAILED");
+    }
+#endif
+
+    auto start     = Clock::now();
+    int  delivered = 0;
+    for (int i = 0; i < BENCHMARK_FIRES; ++i)
+    {
+        delivered += bus.Fire(hit);
+    }
+    double fireNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / BENCHMARK_FIRES;
+    LogInfo("App", "Fire with 4 subscribers: %.2f ns (%d deliveries)", fireNs, delivered);
+
+    LogInfo("App", "=== Game Event Bus Test Complete ===");
+}
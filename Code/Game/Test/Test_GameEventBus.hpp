@@ -0,0 +1,6 @@
+#pragma once
+
+// Checks GameEventBus reentrancy: subscribing, unsubscribing and firing again from inside a
+// callback, consumption and queued delivery from a worker thread. Then checks that a warmed-up
+// Fire of a gameplay event allocates nothing and times it.
+void RunTest_GameEventBus();
@@ -0,0 +1,8 @@
+#pragma once
+
+// Headless frame driver: checks the RenderDevice state counters, then runs a temporary Game for
+// frameCount Update/Render frames against a NullRenderDevice with g_theRenderer hidden. Checks that
+// every frame draws and that steady frames submit the same work, then logs the recorded counters,
+// CPU frame time and what an arena restart of the game costs. Must run before the real game is
+// created, it resets the game arena. Does nothing when frameCount <= 0.
+void RunTest_HeadlessRender(int frameCount);
@@ -0,0 +1,91 @@
+#include "Test_IndexedMesh.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/GameCommon.hpp"
+
+namespace
+{
+    void LogMeshComparison(const char* name, const std::vector<Vertex_PCU>& triangleList, const std::vector<Vertex_PCU>& verts, const std::vector<unsigned int>& indexes)
+    {
+        using namespace enigma::core;
+
+        size_t unindexedBytes = sizeof(Vertex_PCU) * triangleList.size();
+        size_t index32Bytes   = sizeof(Vertex_PCU) * verts.size() + sizeof(uint32_t) * indexes.size();
+        size_t index16Bytes   = sizeof(Vertex_PCU) * verts.size() + sizeof(uint16_t) * indexes.size();
+        bool   fitsIn16Bits   = verts.size() <= 0xFFFF;
+
+        LogInfo("App", "%s: %zu verts unindexed -> %zu verts + %zu indexes (%.2fx fewer verts)", name, triangleList.size(), verts.size(), indexes.size(),
+                verts.empty() ? 0.0 : static_cast<double>(triangleList.size()) / static_cast<double>(verts.size()));
+        LogInfo("App", "%s: %zu bytes -> %zu bytes (32-bit), %zu bytes (16-bit%s), %.2fx smaller", name, unindexedBytes, index32Bytes, index16Bytes, fitsIn16Bits ? "" : ", does not fit",
+                static_cast<double>(unindexedBytes) / static_cast<double>(fitsIn16Bits ? index16Bytes : index32Bytes));
+    }
+}
+
+void RunTest_IndexedMesh()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int SPHERE_SLICES = 64;
+    constexpr int SPHERE_STACKS = 32;
+    constexpr int ITERATIONS    = 100;
+
+    LogInfo("App", "=== Indexed Mesh Benchmark Starting ===");
+
+    // Test 1: Cube
+    std::vector<Vertex_PCU>   cubeTriangles;
+    std::vector<Vertex_PCU>   cubeVerts;
+    std::vector<unsigned int> cubeIndexes;
+    AddVertsForCube3D(cubeTriangles, Rgba8::WHITE);
+    AddVertsForIndexedCube3D(cubeVerts, cubeIndexes, Rgba8::WHITE);
+    LogMeshComparison("Cube", cubeTriangles, cubeVerts, cubeIndexes);
+
+    // Test 2: 64x32 sphere, the same tessellation as Game::m_ball
+    std::vector<Vertex_PCU>   sphereTriangles;
+    std::vector<Vertex_PCU>   sphereVerts;
+    std::vector<unsigned int> sphereIndexes;
+    AddVertsForSphere3D(sphereTriangles, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    AddVertsForIndexedSphere3D(sphereVerts, sphereIndexes, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    LogMeshComparison("Sphere 64x32", sphereTriangles, sphereVerts, sphereIndexes);
+
+    // Test 3: Welding the engine's unindexed sphere must reach the same vertex count
+    std::vector<Vertex_PCU>   weldedVerts;
+    std::vector<unsigned int> weldedIndexes;
+    WeldTriangleList(sphereTriangles, weldedVerts, weldedIndexes);
+    LogMeshComparison("Welded sphere", sphereTriangles, weldedVerts, weldedIndexes);
+    if (weldedVerts.size() != sphereVerts.size())
+    {
+        LogError("App", "- Welded vertex count %zu does not match indexed sphere vertex count %zu", weldedVerts.size(), sphereVerts.size());
+    }
+
+    // Test 4: Generation cost
+    auto startTime = Clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        sphereTriangles.clear();
+        AddVertsForSphere3D(sphereTriangles, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    }
+    double unindexedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    startTime = Clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        sphereVerts.clear();
+        sphereIndexes.clear();
+        AddVertsForIndexedSphere3D(sphereVerts, sphereIndexes, Vec3(0, 0, 0), 2, Rgba8::WHITE, AABB2::ZERO_TO_ONE, SPHERE_SLICES, SPHERE_STACKS);
+    }
+    double indexedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    LogInfo("App", "Sphere generation: unindexed %.1f us, indexed %.1f us", unindexedSeconds * 1e6 / ITERATIONS, indexedSeconds * 1e6 / ITERATIONS);
+
+    LogInfo("App", "=== Indexed Mesh Benchmark Complete ===");
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Compares the unindexed AddVertsFor* generators against their indexed variants: vertex and
+// index counts, bytes per mesh with 16- and 32-bit indexes, and generation time.
+void RunTest_IndexedMesh();
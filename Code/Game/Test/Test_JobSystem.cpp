@@ -0,0 +1,197 @@
+#include "Test_JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/EntityStore.hpp"
+#include "Game/Framework/JobSystem.hpp"
+#include "Game/GameCommon.hpp"
+
+namespace
+{
+    struct DependencyTest
+    {
+        JobSystem*           m_jobSystem = nullptr;
+        std::atomic<int64_t> m_childSum{0};
+        int64_t              m_parentResult = 0;
+    };
+
+    void RunChild(void* data, size_t begin, size_t end)
+    {
+        DependencyTest& test = *static_cast<DependencyTest*>(data);
+        test.m_childSum.fetch_add(static_cast<int64_t>(begin + end));
+    }
+
+    void RunParent(void* data, size_t, size_t)
+    {
+        // The parent depends on its children: it submits them and waits on their counter
+        DependencyTest& test = *static_cast<DependencyTest*>(data);
+        JobCounter      children;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            Job child;
+            child.m_function = &RunChild;
+            child.m_data     = &test;
+            child.m_begin    = i;
+            child.m_end      = i;
+            child.m_counter  = &children;
+            test.m_jobSystem->Run(child);
+        }
+        test.m_jobSystem->Wait(children);
+        test.m_parentResult = test.m_childSum.load();
+    }
+
+    void CountRun(void* data, size_t begin, size_t)
+    {
+        static_cast<std::atomic<int>*>(data)[begin].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    double TimeEntityUpdate(JobSystem& jobSystem, EntityStore& entities, int frameCount)
+    {
+        using Clock = std::chrono::high_resolution_clock;
+
+        auto start = Clock::now();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            jobSystem.ParallelFor(0, entities.GetCount(), ENTITY_UPDATE_GRAIN_SIZE, [&entities](size_t begin, size_t end)
+            {
+                entities.IntegrateRange(begin, end, 1.f / 60.f);
+                entities.UpdateWorldTransformsRange(begin, end);
+            });
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+    }
+}
+
+void RunTest_JobSystem(int benchmarkMaxEntities)
+{
+    using namespace enigma::core;
+
+    LogInfo("App", "=== Job System Test Starting ===");
+
+    int hardwareThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    {
+        JobSystem jobSystem(hardwareThreads);
+
+        // Every index visited exactly once
+        constexpr size_t     RANGE_SIZE = 1000000;
+        std::vector<uint8_t> visits(RANGE_SIZE, 0);
+        std::atomic<int64_t> sum{0};
+        jobSystem.ParallelFor(0, RANGE_SIZE, 1024, [&](size_t begin, size_t end)
+        {
+            int64_t localSum = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                ++visits[i];
+                localSum += static_cast<int64_t>(i);
+            }
+            sum.fetch_add(localSum);
+        });
+        bool passed = sum.load() == static_cast<int64_t>(RANGE_SIZE) * (RANGE_SIZE - 1) / 2;
+        for (uint8_t visit : visits)
+        {
+            passed = passed && visit == 1;
+        }
+        LogInfo("App", "ParallelFor over %zu indexes on %d threads: %s", RANGE_SIZE, jobSystem.GetThreadCount(), passed ? "PASSED" : "FAILED");
+
+        // Nested dependency: children finish before the parent reads their sum
+        DependencyTest test;
+        test.m_jobSystem = &jobSystem;
+        JobCounter parentCounter;
+        Job        parent;
+        parent.m_function = &RunParent;
+        parent.m_data     = &test;
+        parent.m_counter  = &parentCounter;
+        jobSystem.Run(parent);
+        jobSystem.Wait(parentCounter);
+        LogInfo("App", "Nested job dependencies: %s", test.m_parentResult == 240 ? "PASSED" : "FAILED");
+
+        // More Run() calls than a deque holds, with no Wait() in between: each job runs exactly once
+        constexpr size_t                    OVERFLOW_JOBS = JobSystem::DEQUE_CAPACITY * 3 + 7;
+        std::unique_ptr<std::atomic<int>[]> runCounts     = std::make_unique<std::atomic<int>[]>(OVERFLOW_JOBS);
+        JobCounter                          overflowCounter;
+        for (size_t i = 0; i < OVERFLOW_JOBS; ++i)
+        {
+            Job job;
+            job.m_function = &CountRun;
+            job.m_data     = runCounts.get();
+            job.m_begin    = i;
+            job.m_counter  = &overflowCounter;
+            jobSystem.Run(job);
+        }
+        jobSystem.Wait(overflowCounter);
+        bool overflowPassed = true;
+        for (size_t i = 0; i < OVERFLOW_JOBS; ++i)
+        {
+            overflowPassed = overflowPassed && runCounts[i].load() == 1;
+        }
+        LogInfo("App", "%zu jobs queued past the deque capacity each run once: %s", OVERFLOW_JOBS, overflowPassed ? "PASSED" : "FAILED");
+
+        // Nested systems: the inner one takes this thread's slot and gives it back
+        bool nestedPassed = true;
+        {
+            JobSystem innerSystem(2);
+            nestedPassed = innerSystem.GetCurrentThreadIndex() == 0 && jobSystem.GetCurrentThreadIndex() == 0;
+            jobSystem.ParallelFor(0, 4096, 64, [](size_t, size_t) {});
+            innerSystem.ParallelFor(0, 4096, 64, [](size_t, size_t) {});
+        }
+        int outsiderIndex = 0;
+        std::thread outsider([&jobSystem, &outsiderIndex]()
+        {
+            outsiderIndex = jobSystem.GetCurrentThreadIndex();
+        });
+        outsider.join();
+        nestedPassed = nestedPassed && jobSystem.GetCurrentThreadIndex() == 0 && outsiderIndex == -1;
+        LogInfo("App", "Nested systems and outsider threads: %s", nestedPassed ? "PASSED" : "FAILED");
+    }
+
+    if (benchmarkMaxEntities > 0)
+    {
+        std::vector<int> threadCounts;
+        for (int threads = 1; threads < hardwareThreads; threads *= 2)
+        {
+            threadCounts.push_back(threads);
+        }
+        threadCounts.push_back(hardwareThreads);
+
+        for (int entityCount : {10000, 100000, 1000000})
+        {
+            if (entityCount > benchmarkMaxEntities)
+            {
+                break;
+            }
+
+            // Every entity moves, so every frame integrates and rebuilds every transform
+            EntityStore entities;
+            entities.Reserve(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                EntityHandle handle = entities.Create(Vec3(static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.f));
+                entities.SetVelocity(handle, Vec3(0.f, 0.f, 1.f));
+                entities.SetAngularVelocity(handle, EulerAngles(static_cast<float>(i % 90), 0.f, 0.f));
+            }
+
+            int    frameCount     = std::max(5, 10000000 / entityCount);
+            double singleThreadMs = 0.0;
+            for (int threads : threadCounts)
+            {
+                JobSystem jobSystem(threads);
+                double    frameMs = TimeEntityUpdate(jobSystem, entities, frameCount);
+                if (threads == 1)
+                {
+                    singleThreadMs = frameMs;
+                }
+                LogInfo("App", "%7d entities, %2d threads: %8.3f ms/frame (%.2fx)", entityCount, threads, frameMs, singleThreadMs / frameMs);
+            }
+        }
+    }
+
+    LogInfo("App", "=== Job System Test Complete ===");
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks JobSystem parallel-for coverage, nested job dependencies, that jobs queued past the deque
+// capacity each run once, that a nested system hands the creating thread back and that outsider
+// threads are not members, then, when benchmarkMaxEntities > 0, times the game's entity update at
+// 10k, 100k and 1M entities (up to that count) on 1 to N threads.
+void RunTest_JobSystem(int benchmarkMaxEntities);
@@ -0,0 +1,220 @@
+#include "Test_MemoryTracker.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Game/Framework/MemoryTracker.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+namespace
+{
+    constexpr int    THREAD_ALLOCATIONS = 100;
+    constexpr int    FRAME_ALLOCATIONS  = 5;
+    constexpr size_t PEAK_BYTES         = 1024 * 1024;
+    constexpr int    BENCHMARK_PAIRS    = 1000000;
+
+    // Publishes the tested pointers; the compiler may drop a new/delete pair nothing else observes
+    void* volatile g_sink = nullptr;
+
+    struct alignas(64) CacheLine
+    {
+        float m_values[16];
+    };
+
+    /// Live bytes and allocations of a tag since a baseline
+    struct TagDelta
+    {
+        explicit TagDelta(MemoryTag tag)
+            : m_tag(tag)
+            , m_before(MemoryTracker::GetTagStats(tag))
+        {
+        }
+
+        int64_t  LiveBytes() const { return MemoryTracker::GetTagStats(m_tag).m_liveBytes - m_before.m_liveBytes; }
+        int64_t  LiveAllocations() const { return MemoryTracker::GetTagStats(m_tag).m_liveAllocations - m_before.m_liveAllocations; }
+        uint64_t TotalAllocations() const { return MemoryTracker::GetTagStats(m_tag).m_totalAllocations - m_before.m_totalAllocations; }
+
+        MemoryTag               m_tag;
+        MemoryTracker::TagStats m_before;
+    };
+}
+
+void RunTest_MemoryTracker()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    LogInfo("App", "=== Memory Tracker Test Starting ===");
+
+#if GAME_MEMORY_TRACKING_ENABLED
+    // Attribution: allocations go to the scope's tag, frees come back off it whatever tag is current
+    {
+        bool passed = true;
+        {
+            MEMORY_TAG_SCOPE(MemoryTag::Tests);
+            TagDelta   delta(MemoryTag::Tests);
+            char*      bytes     = new char[1000];
+            CacheLine* cacheLine = new CacheLine();
+            g_sink               = bytes;
+            passed               = reinterpret_cast<uintptr_t>(cacheLine) % alignof(CacheLine) == 0;
+            passed               = passed && delta.LiveBytes() == static_cast<int64_t>(1000 + sizeof(CacheLine)) && delta.LiveAllocations() == 2;
+            {
+                MEMORY_TAG_SCOPE(MemoryTag::Untagged);
+                delete[] bytes;
+                delete cacheLine;
+            }
+            passed = passed && delta.LiveBytes() == 0 && delta.LiveAllocations() == 0 && delta.TotalAllocations() == 2;
+            passed = passed && MemoryTracker::GetThreadTag() == MemoryTag::Tests;
+        }
+        LogInfo("App", "Tag attribution, aligned blocks and cross-tag frees: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Threads: tags are per thread, a new thread starts untagged
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Untagged);
+        TagDelta           delta(MemoryTag::Tests);
+        std::vector<void*> blocks;
+        blocks.reserve(THREAD_ALLOCATIONS);
+        bool startsUntagged = false;
+
+        std::thread thread([&blocks, &startsUntagged]()
+        {
+            startsUntagged = MemoryTracker::GetThreadTag() == MemoryTag::Untagged;
+            MEMORY_TAG_SCOPE(MemoryTag::Tests);
+            for (int i = 0; i < THREAD_ALLOCATIONS; ++i)
+            {
+                blocks.push_back(::operator new(64));
+            }
+        });
+        thread.join();
+        bool passed = startsUntagged && MemoryTracker::GetThreadTag() == MemoryTag::Untagged;
+        passed      = passed && delta.LiveBytes() == 64 * THREAD_ALLOCATIONS && delta.LiveAllocations() == THREAD_ALLOCATIONS;
+        for (void* block : blocks)
+        {
+            ::operator delete(block);
+        }
+        passed = passed && delta.LiveBytes() == 0 && delta.TotalAllocations() == THREAD_ALLOCATIONS;
+        LogInfo("App", "Per-thread tags: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // High-water mark: survives the free, restarts on reset. Only the test tag's peak is reset.
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Tests);
+        MemoryTracker::ResetPeak(MemoryTag::Tests);
+        int64_t liveBefore = MemoryTracker::GetTagStats(MemoryTag::Tests).m_liveBytes;
+        void*   block      = ::operator new(PEAK_BYTES);
+        ::operator delete(block);
+
+        MemoryTracker::TagStats stats  = MemoryTracker::GetTagStats(MemoryTag::Tests);
+        bool                    passed = stats.m_peakBytes == liveBefore + static_cast<int64_t>(PEAK_BYTES) && stats.m_liveBytes == liveBefore;
+        passed                         = passed && MemoryTracker::GetTotalStats().m_peakBytes >= stats.m_peakBytes;
+        MemoryTracker::ResetPeak(MemoryTag::Tests);
+        passed = passed && MemoryTracker::GetTagStats(MemoryTag::Tests).m_peakBytes == liveBefore;
+        LogInfo("App", "High-water marks: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Frames: EndFrame() closes each frame's count
+    {
+        MEMORY_TAG_SCOPE(MemoryTag::Tests);
+        void* blocks[FRAME_ALLOCATIONS];
+        MemoryTracker::EndFrame();
+        for (void*& block : blocks)
+        {
+            block = ::operator new(32);
+        }
+        for (void* block : blocks)
+        {
+            ::operator delete(block);
+        }
+        MemoryTracker::EndFrame();
+        MemoryTracker::TagStats busy = MemoryTracker::GetTagStats(MemoryTag::Tests);
+        MemoryTracker::EndFrame();
+        MemoryTracker::TagStats idle = MemoryTracker::GetTagStats(MemoryTag::Tests);
+
+        float history[MemoryTracker::HISTORY_FRAME_COUNT];
+        int   historyCount = MemoryTracker::GetFrameAllocationHistory(history, MemoryTracker::HISTORY_FRAME_COUNT);
+        bool  passed       = busy.m_lastFrameAllocations == FRAME_ALLOCATIONS && busy.m_lastFrameBytes == 32 * FRAME_ALLOCATIONS;
+        passed             = passed && idle.m_lastFrameAllocations == 0 && historyCount >= 2 && history[historyCount - 2] >= FRAME_ALLOCATIONS;
+        LogInfo("App", "Per-frame allocation counts: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Steady state: once its buffers have grown, a profiled frame allocates nothing
+    {
+        Profiler profiler;
+        auto     profiledFrame = [&profiler]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                PROFILE_SCOPE("Outer");
+                PROFILE_SCOPE("Inner");
+            }
+            profiler.EndFrame();
+        };
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            profiledFrame();
+        }
+
+        TagDelta profilerDelta(MemoryTag::Profiler);
+        TagDelta testsDelta(MemoryTag::Tests);
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            profiledFrame();
+        }
+        bool passed = profilerDelta.TotalAllocations() == 0 && testsDelta.TotalAllocations() == 0;
+        LogInfo("App", "Warmed-up profiler frame allocates nothing: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // JSON dump names every tag
+    {
+        std::filesystem::path path   = std::filesystem::temp_directory_path() / "enigma_memory_test" / "memory.json";
+        bool                  passed = MemoryTracker::ExportJson(path.string());
+
+        std::ifstream     file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        std::string json = contents.str();
+        file.close();
+
+        passed = passed && json.find("\"trackingEnabled\":true") != std::string::npos && json.find("\"tags\"") != std::string::npos;
+        for (int tag = 0; tag < static_cast<int>(MemoryTag::COUNT); ++tag)
+        {
+            passed = passed && json.find(std::string("\"") + MemoryTracker::GetTagName(static_cast<MemoryTag>(tag)) + "\"") != std::string::npos;
+        }
+        std::error_code error;
+        std::filesystem::remove_all(path.parent_path(), error);
+        LogInfo("App", "JSON dump: %s", passed ? "PASSED" : "FAILED");
+    }
+#endif
+
+    // Cost of a tracked allocation over the allocator underneath it
+    auto start = Clock::now();
+    for (int i = 0; i < BENCHMARK_PAIRS; ++i)
+    {
+        g_sink = ::operator new(64);
+        ::operator delete(g_sink);
+    }
+    double newDeleteNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / BENCHMARK_PAIRS;
+
+    start = Clock::now();
+    for (int i = 0; i < BENCHMARK_PAIRS; ++i)
+    {
+        g_sink = std::malloc(64);
+        std::free(g_sink);
+    }
+    double mallocFreeNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / BENCHMARK_PAIRS;
+
+    LogInfo("App", "64-byte allocate/free pairs (GAME_MEMORY_TRACKING_ENABLED=%d):", GAME_MEMORY_TRACKING_ENABLED);
+    LogInfo("App", "  operator new/delete: %6.2f ns", newDeleteNs);
+    LogInfo("App", "  malloc/free:         %6.2f ns", mallocFreeNs);
+
+    LogInfo("App", "=== Memory Tracker Test Complete ===");
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Checks that tracked allocations land in the allocating thread's tag (and leave it when freed on
+// another), high-water marks, per-frame counts, that a warmed-up Profiler frame allocates nothing
+// and the JSON dump, then times a tracked new/delete against plain malloc/free.
+void RunTest_MemoryTracker();
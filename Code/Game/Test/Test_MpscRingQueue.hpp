@@ -0,0 +1,6 @@
+#pragma once
+
+// Several producer threads push into one MpscRingQueue while the main thread drains it
+// concurrently. Checks that nothing is lost or duplicated and that each producer's items arrive
+// in the order it pushed them, then reports the drain throughput.
+void RunTest_MpscRingQueue();
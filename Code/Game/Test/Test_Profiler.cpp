@@ -0,0 +1,281 @@
+#include "Test_Profiler.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <new>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Game/Framework/Profiler.hpp"
+
+namespace
+{
+    constexpr int THREAD_COUNT     = 4;
+    constexpr int CALLS_PER_THREAD = 1000;
+    constexpr int BENCHMARK_SCOPES = 1000000;
+    constexpr int SCOPES_PER_FLUSH = 8192; // Below THREAD_EVENT_CAPACITY, so nothing is dropped
+
+    thread_local volatile uint64_t t_sink = 0;
+
+    /// Keeps the timed loop body from being folded away
+    void DoWork(int i)
+    {
+        t_sink = t_sink + static_cast<uint64_t>(i);
+    }
+
+#if GAME_PROFILER_ENABLED
+    /// First node named name among the siblings starting at first, -1 if none
+    int FindSibling(const Profiler::Frame& frame, int first, const char* name)
+    {
+        for (int index = first; index != -1; index = frame.m_nodes[index].m_nextSibling)
+        {
+            if (std::string(frame.m_nodes[index].m_name) == name)
+            {
+                return index;
+            }
+        }
+        return -1;
+    }
+
+    int CountOccurrences(const std::string& text, const std::string& pattern)
+    {
+        int    count    = 0;
+        size_t position = text.find(pattern);
+        while (position != std::string::npos)
+        {
+            ++count;
+            position = text.find(pattern, position + pattern.size());
+        }
+        return count;
+    }
+#endif
+
+    double TimeScopesNs(Profiler& profiler, bool useScope)
+    {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double totalNs = 0.0;
+        for (int flushed = 0; flushed < BENCHMARK_SCOPES; flushed += SCOPES_PER_FLUSH)
+        {
+            auto start = Clock::now();
+            for (int i = 0; i < SCOPES_PER_FLUSH; ++i)
+            {
+                if (useScope)
+                {
+                    PROFILE_SCOPE("Benchmark");
+                    DoWork(i);
+                }
+                else
+                {
+                    DoWork(i);
+                }
+            }
+            totalNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            profiler.EndFrame();
+        }
+        return totalNs / BENCHMARK_SCOPES;
+    }
+}
+
+void RunTest_Profiler()
+{
+    using namespace enigma::core;
+
+    LogInfo("App", "=== Profiler Test Starting ===");
+
+    // A profiler of its own: the game's keeps recording into its startup capture around this one
+    Profiler profiler;
+    profiler.EndFrame(); // Close this profiler's startup capture
+
+#if GAME_PROFILER_ENABLED
+    // Nesting and merging: repeated calls under one parent become one node with a call count
+    {
+        {
+            PROFILE_SCOPE("Outer");
+            for (int i = 0; i < 3; ++i)
+            {
+                PROFILE_SCOPE("Leaf");
+                DoWork(i);
+            }
+            {
+                PROFILE_SCOPE("Middle");
+                PROFILE_SCOPE("Leaf");
+                DoWork(0);
+            }
+        }
+        {
+            PROFILE_SCOPE("Outer");
+        }
+        profiler.EndFrame();
+
+        const Profiler::Frame& frame  = profiler.GetLastFrame();
+        int                    outer  = frame.m_firstRoots.empty() ? -1 : FindSibling(frame, frame.m_firstRoots[0], "Outer");
+        bool                   passed = outer != -1 && frame.m_nodes[outer].m_callCount == 2 && frame.m_nodes[outer].m_nextSibling == -1;
+        if (passed)
+        {
+            int leaf   = FindSibling(frame, frame.m_nodes[outer].m_firstChild, "Leaf");
+            int middle = FindSibling(frame, frame.m_nodes[outer].m_firstChild, "Middle");
+            passed     = leaf != -1 && middle != -1 && frame.m_nodes[leaf].m_callCount == 3 && frame.m_nodes[leaf].m_parent == outer;
+            passed     = passed && frame.m_nodes[middle].m_depth == 1 && frame.m_nodes[leaf].m_depth == 1;
+
+            int innerLeaf = passed ? FindSibling(frame, frame.m_nodes[middle].m_firstChild, "Leaf") : -1;
+            passed        = passed && innerLeaf != -1 && frame.m_nodes[innerLeaf].m_callCount == 1 && frame.m_nodes[innerLeaf].m_depth == 2;
+
+            // Exclusive time is what the children do not account for
+            const Profiler::Node& node     = frame.m_nodes[outer];
+            double                children = frame.m_nodes[leaf].m_inclusiveMs + frame.m_nodes[middle].m_inclusiveMs;
+            passed                         = passed && std::fabs(node.m_exclusiveMs - (node.m_inclusiveMs - children)) < 1e-6 && node.m_exclusiveMs >= 0.0;
+        }
+        LogInfo("App", "Nesting, merged call counts and exclusive time: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Merging goes by the name's text: two arrays holding one name are separate objects
+    {
+        static const char NAME_COPY_A[] = "Copied";
+        static const char NAME_COPY_B[] = "Copied";
+        {
+            PROFILE_SCOPE(NAME_COPY_A);
+        }
+        {
+            PROFILE_SCOPE(NAME_COPY_B);
+        }
+        profiler.EndFrame();
+
+        const Profiler::Frame& frame  = profiler.GetLastFrame();
+        int                    copied = frame.m_firstRoots.empty() ? -1 : FindSibling(frame, frame.m_firstRoots[0], "Copied");
+        bool                   passed = copied != -1 && frame.m_nodes[copied].m_callCount == 2 && frame.m_nodes[copied].m_nextSibling == -1;
+        LogInfo("App", "Equal names at different addresses merge: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // A profiler built where a destroyed one lived gets fresh thread buffers, not the dead one's
+    {
+        alignas(Profiler) unsigned char storage[sizeof(Profiler)];
+        Profiler*                       first = new(storage) Profiler();
+        {
+            PROFILE_SCOPE("First");
+        }
+        first->EndFrame();
+        first->~Profiler();
+
+        Profiler* second = new(storage) Profiler();
+        {
+            PROFILE_SCOPE("Second");
+        }
+        second->EndFrame();
+        const Profiler::Frame& frame  = second->GetLastFrame();
+        int                    root   = frame.m_firstRoots.empty() ? -1 : FindSibling(frame, frame.m_firstRoots[0], "Second");
+        bool                   passed = second->GetGeneration() != 0 && root != -1 && frame.m_nodes[root].m_callCount == 1;
+        second->~Profiler();
+        LogInfo("App", "Profiler reusing a destroyed one's address: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Threads: each records into its own ring and gets its own named tree
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t)
+        {
+            threads.emplace_back([t]()
+            {
+                Profiler::SetThreadName(("Worker " + std::to_string(t)).c_str());
+                for (int i = 0; i < CALLS_PER_THREAD; ++i)
+                {
+                    PROFILE_SCOPE("Work");
+                    PROFILE_SCOPE("Inner");
+                    DoWork(i);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        profiler.EndFrame();
+
+        const Profiler::Frame& frame       = profiler.GetLastFrame();
+        int                    workerTrees = 0;
+        bool                   passed      = true;
+        for (size_t threadId = 0; threadId < frame.m_firstRoots.size(); ++threadId)
+        {
+            int work = frame.m_firstRoots[threadId] == -1 ? -1 : FindSibling(frame, frame.m_firstRoots[threadId], "Work");
+            if (work == -1)
+            {
+                continue;
+            }
+            ++workerTrees;
+            int inner = FindSibling(frame, frame.m_nodes[work].m_firstChild, "Inner");
+            passed    = passed && frame.m_nodes[work].m_callCount == CALLS_PER_THREAD && inner != -1 && frame.m_nodes[inner].m_callCount == CALLS_PER_THREAD;
+            passed    = passed && profiler.GetThreadName(static_cast<uint32_t>(threadId)).rfind("Worker ", 0) == 0;
+        }
+        passed = passed && workerTrees == THREAD_COUNT;
+        LogInfo("App", "%d threads, one named tree each: %s", THREAD_COUNT, passed ? "PASSED" : "FAILED");
+    }
+
+    // Overflow: scopes past the ring's capacity are dropped and counted, not blocked on
+    {
+        uint64_t droppedBefore = profiler.GetDroppedEventCount();
+        for (size_t i = 0; i < Profiler::THREAD_EVENT_CAPACITY + 10; ++i)
+        {
+            PROFILE_SCOPE("Flood");
+        }
+        profiler.EndFrame();
+
+        const Profiler::Frame& frame  = profiler.GetLastFrame();
+        int                    flood  = FindSibling(frame, frame.m_firstRoots[0], "Flood");
+        bool                   passed = profiler.GetDroppedEventCount() - droppedBefore == 10;
+        passed                        = passed && flood != -1 && frame.m_nodes[flood].m_callCount == static_cast<int>(Profiler::THREAD_EVENT_CAPACITY);
+        LogInfo("App", "Ring overflow drops and counts: %s", passed ? "PASSED" : "FAILED");
+    }
+
+    // Export: every captured scope becomes one complete event, every thread a name record
+    {
+        profiler.StartCapture(2);
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            {
+                PROFILE_SCOPE("Frame");
+                for (int i = 0; i < 5; ++i)
+                {
+                    PROFILE_SCOPE("Step\t\"quoted\"");
+                }
+            }
+            profiler.EndFrame();
+        }
+
+        std::filesystem::path path   = std::filesystem::temp_directory_path() / "enigma_profiler_test" / "trace.json";
+        bool                  passed = !profiler.IsCapturing() && profiler.GetCaptureEventCount() == 12 && profiler.ExportChromeTrace(path.string());
+
+        std::ifstream     file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        std::string json = contents.str();
+        file.close();
+
+        passed = passed && json.find("\"traceEvents\"") != std::string::npos && json.back() == '\n';
+        passed = passed && CountOccurrences(json, "\"ph\":\"X\"") == 12 && CountOccurrences(json, "\"ph\":\"M\"") >= 1;
+        passed = passed && json.find("Step\\u0009\\\"quoted\\\"") != std::string::npos && json.find('\t') == std::string::npos;
+        passed = passed && CountOccurrences(json, "{") == CountOccurrences(json, "}") && CountOccurrences(json, "[") == CountOccurrences(json, "]");
+        std::error_code error;
+        std::filesystem::remove_all(path.parent_path(), error);
+        LogInfo("App", "Chrome trace export: %s", passed ? "PASSED" : "FAILED");
+    }
+#endif
+
+    // Overhead per scope
+    double bareNs      = TimeScopesNs(profiler, false);
+    double recordingNs = TimeScopesNs(profiler, true);
+    profiler.SetRecording(false);
+    double pausedNs = TimeScopesNs(profiler, true);
+    profiler.SetRecording(true);
+
+    LogInfo("App", "PROFILE_SCOPE cost over %d scopes (GAME_PROFILER_ENABLED=%d):", BENCHMARK_SCOPES, GAME_PROFILER_ENABLED);
+    LogInfo("App", "  recording: %6.2f ns per scope", recordingNs - bareNs);
+    LogInfo("App", "  paused:    %6.2f ns per scope", pausedNs - bareNs);
+
+    LogInfo("App", "=== Profiler Test Complete ===");
+}
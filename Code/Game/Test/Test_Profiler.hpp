@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks the profiler's call trees (nesting, merging repeated calls by name text, one tree per
+// thread, a profiler reusing a destroyed one's address), ring overflow accounting and Chrome trace
+// export with escaped names, then times PROFILE_SCOPE with recording on, with recording off and
+// against an unprofiled loop.
+void RunTest_Profiler();
@@ -0,0 +1,143 @@
+#include "Test_RenderCommandQueue.hpp"
+
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Game/Render/NullRenderDevice.hpp"
+#include "Game/Render/RenderCommandQueue.hpp"
+
+namespace
+{
+    constexpr int OPAQUE_PACKET_COUNT      = 400;
+    constexpr int TRANSLUCENT_PACKET_COUNT = 50;
+    constexpr int TEXTURE_COUNT            = 8;
+    constexpr int ALIASED_TEXTURE_COUNT    = 5000; // More than the 12 texture bits of the sort key
+
+    /// Records the state bound at every draw; the model color carries the packet's index
+    class RecordingRenderDevice : public NullRenderDevice
+    {
+    public:
+        struct Draw
+        {
+            BlendMode m_blendMode;
+            Texture*  m_texture;
+            int       m_packetIndex;
+        };
+
+        std::vector<Draw> m_draws;
+
+    protected:
+        void OnSetModelConstants(const Mat44&, const Rgba8& modelColor) override { m_packetIndex = modelColor.r | (modelColor.g << 8) | (modelColor.b << 16); }
+        void OnDrawVertexArray(int, const Vertex_PCU*) override { m_draws.push_back(Draw{m_boundBlendMode, m_boundTexture, m_packetIndex}); }
+
+    private:
+        int m_packetIndex = -1;
+    };
+
+    Rgba8 EncodePacketIndex(int index)
+    {
+        return Rgba8(static_cast<unsigned char>(index & 0xFF), static_cast<unsigned char>((index >> 8) & 0xFF), static_cast<unsigned char>((index >> 16) & 0xFF), 255);
+    }
+
+    /// Distinct, never dereferenced texture pointers
+    Texture* FakeTexture(std::vector<char>& storage, int index)
+    {
+        return reinterpret_cast<Texture*>(storage.data() + index);
+    }
+}
+
+void RunTest_RenderCommandQueue()
+{
+    using namespace enigma::core;
+
+    LogInfo("App", "=== Render Command Queue Test Starting ===");
+
+    std::vector<Vertex_PCU> triangle(3);
+    std::vector<char>       textureStorage(ALIASED_TEXTURE_COUNT);
+
+    // Worst case for unsorted submission: texture and rasterizer change on every packet, with
+    // translucent packets interleaved
+    std::vector<RenderPacketState> states;
+    for (int i = 0; i < OPAQUE_PACKET_COUNT + TRANSLUCENT_PACKET_COUNT; ++i)
+    {
+        RenderPacketState state;
+        state.m_texture        = FakeTexture(textureStorage, i % TEXTURE_COUNT);
+        state.m_rasterizerMode = i % 2 == 0 ? RasterizerMode::SOLID_CULL_BACK : RasterizerMode::SOLID_CULL_NONE;
+        state.m_blendMode      = i % 9 == 8 ? BlendMode::ALPHA : BlendMode::OPAQUE;
+        states.push_back(state);
+    }
+
+    RecordingRenderDevice device;
+    device.BeginFrame();
+    for (int i = 0; i < static_cast<int>(states.size()); ++i)
+    {
+        const RenderPacketState& state = states[i];
+        device.SetDepthMode(state.m_depthMode);
+        device.SetRasterizerMode(state.m_rasterizerMode);
+        device.SetBlendMode(state.m_blendMode);
+        device.SetSamplerMode(state.m_samplerMode);
+        device.BindTexture(state.m_texture);
+        device.SetModelConstants(Mat44(), EncodePacketIndex(i));
+        device.DrawVertexArray(triangle);
+    }
+    RenderStats unsortedStats = device.GetFrameStats();
+
+    RenderCommandQueue queue;
+    for (int i = 0; i < static_cast<int>(states.size()); ++i)
+    {
+        queue.DrawVertexArray(states[i], Mat44(), EncodePacketIndex(i), triangle);
+    }
+    device.BeginFrame();
+    device.m_draws.clear();
+    queue.Flush(device);
+    RenderStats sortedStats = device.GetFrameStats();
+
+    // Opaque packets fall into 2 rasterizer x TEXTURE_COUNT texture groups
+    bool passed = sortedStats.m_drawCalls == unsortedStats.m_drawCalls && sortedStats.GetStateChangeCount() < unsortedStats.GetStateChangeCount();
+    passed      = passed && sortedStats.m_rasterizerChanges <= 2 + TRANSLUCENT_PACKET_COUNT;
+    LogInfo("App", "State changes fall when sorted (%d unsorted, %d sorted): %s", unsortedStats.GetStateChangeCount(), sortedStats.GetStateChangeCount(),
+            passed ? "PASSED" : "FAILED");
+
+    // Translucent packets come after every opaque one, in the order they were submitted
+    {
+        bool inTranslucent   = false;
+        int  lastTranslucent = -1;
+        bool ordered         = static_cast<int>(device.m_draws.size()) == static_cast<int>(states.size());
+        for (const RecordingRenderDevice::Draw& draw : device.m_draws)
+        {
+            bool isTranslucent = draw.m_blendMode != BlendMode::OPAQUE;
+            ordered            = ordered && (isTranslucent || !inTranslucent);
+            if (isTranslucent)
+            {
+                ordered         = ordered && draw.m_packetIndex > lastTranslucent;
+                lastTranslucent = draw.m_packetIndex;
+                inTranslucent   = true;
+            }
+            ordered = ordered && draw.m_texture == states[draw.m_packetIndex].m_texture;
+        }
+        LogInfo("App", "Translucent packets last, in submission order: %s", ordered ? "PASSED" : "FAILED");
+    }
+
+    // More textures than the key can tell apart: ids alias, every packet still draws with its own texture
+    {
+        for (int i = 0; i < ALIASED_TEXTURE_COUNT; ++i)
+        {
+            RenderPacketState state;
+            state.m_texture = FakeTexture(textureStorage, i);
+            queue.DrawVertexArray(state, Mat44(), EncodePacketIndex(i), triangle);
+        }
+        device.BeginFrame();
+        device.m_draws.clear();
+        queue.Flush(device);
+
+        bool correct = static_cast<int>(device.m_draws.size()) == ALIASED_TEXTURE_COUNT && device.GetFrameStats().m_samplerModeChanges == 1;
+        for (const RecordingRenderDevice::Draw& draw : device.m_draws)
+        {
+            correct = correct && draw.m_texture == FakeTexture(textureStorage, draw.m_packetIndex);
+        }
+        LogInfo("App", "%d textures through aliased sort ids: %s", ALIASED_TEXTURE_COUNT, correct ? "PASSED" : "FAILED");
+    }
+
+    LogInfo("App", "=== Render Command Queue Test Complete ===");
+}
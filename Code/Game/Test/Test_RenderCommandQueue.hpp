@@ -0,0 +1,7 @@
+#pragma once
+
+// Submits the same packets to a NullRenderDevice once in submission order with every packet
+// setting its own state, and once through a RenderCommandQueue. Checks that sorting cuts the
+// state changes, that translucent packets still draw last in submission order, and that more
+// textures than the sort key's texture bits hold still draw correctly.
+void RunTest_RenderCommandQueue();
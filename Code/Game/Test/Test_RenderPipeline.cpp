@@ -0,0 +1,170 @@
+#include "Test_RenderPipeline.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/EntityStore.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Player.hpp"
+#include "Game/Render/EntityMeshRenderer.hpp"
+#include "Game/Render/NullRenderDevice.hpp"
+#include "Game/Render/RenderPipeline.hpp"
+
+namespace
+{
+    constexpr int   FRAME_COUNT    = 120;
+    constexpr float FRAME_SECONDS  = 1.f / 60.f;
+    constexpr int   ORDER_FRAMES   = 32;
+    constexpr int   MARKER_MESH_ID = 0;
+
+    /// Captures one marker instance per frame and checks it survives the trip unchanged
+    bool CheckPresentOrder(int snapshotCount)
+    {
+        bool                  passed = true;
+        std::vector<uint64_t> prepared; // Render thread only until the pipeline is destroyed
+        {
+            RenderPipeline pipeline([&prepared](RenderSnapshot& snapshot)
+            {
+                prepared.push_back(snapshot.m_frameIndex);
+            }, snapshotCount);
+
+            for (uint64_t frame = 0; frame < ORDER_FRAMES; ++frame)
+            {
+                RenderSnapshot& snapshot = pipeline.BeginCapture();
+                snapshot.m_meshInstances.resize(1);
+                snapshot.m_meshInstances[MARKER_MESH_ID].assign(1, MeshInstance());
+                snapshot.m_meshInstances[MARKER_MESH_ID][0].m_tint.r = static_cast<unsigned char>(frame);
+                passed = passed && snapshot.m_frameIndex == frame;
+                pipeline.EndCapture();
+
+                RenderSnapshot* presented = pipeline.AcquirePrepared();
+                uint64_t        latency   = static_cast<uint64_t>(snapshotCount - 1);
+                if (frame < latency)
+                {
+                    passed = passed && presented == nullptr;
+                    continue;
+                }
+                passed = passed && presented && presented->m_frameIndex == frame - latency &&
+                    presented->m_meshInstances[MARKER_MESH_ID][0].m_tint.r == static_cast<unsigned char>(frame - latency);
+                pipeline.ReleasePrepared();
+            }
+
+            pipeline.Discard();
+            passed = passed && pipeline.GetPresentCount() == pipeline.GetCaptureCount() && pipeline.AcquirePrepared() == nullptr;
+        }
+
+        for (size_t i = 0; i < prepared.size(); ++i)
+        {
+            passed = passed && prepared[i] == i;
+        }
+        return passed && prepared.size() == ORDER_FRAMES;
+    }
+
+    void SpawnEntities(EntityStore& entities, int entityCount, uint16_t meshCount)
+    {
+        entities.Reserve(entityCount);
+        for (int i = 0; i < entityCount; ++i)
+        {
+            // A field in front of the default camera, wider than its view so culling has work
+            Vec3         position(5.f + static_cast<float>(i % 250) * 0.5f, static_cast<float>(i / 250 % 200) - 100.f, 0.f);
+            EntityHandle handle = entities.Create(position, static_cast<uint16_t>(i % meshCount));
+            entities.SetVelocity(handle, Vec3(0.f, 0.f, i % 2 == 0 ? 0.5f : -0.5f));
+            entities.SetAngularVelocity(handle, EulerAngles(45.f, 0.f, 0.f));
+        }
+    }
+}
+
+void RunTest_RenderPipeline(int benchmarkEntities)
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    LogInfo("App", "=== Render Pipeline Test Starting ===");
+
+    LogInfo("App", "Double buffered presents in order, one frame behind: %s", CheckPresentOrder(2) ? "PASSED" : "FAILED");
+    LogInfo("App", "Triple buffered presents in order, two frames behind: %s", CheckPresentOrder(3) ? "PASSED" : "FAILED");
+
+    // Frame timing against the null backend: simulate, then cull and record the world pass
+    if (benchmarkEntities > 0)
+    {
+        NullRenderDevice nullDevice;
+        RenderDevice*    previousDevice = g_theRenderDevice;
+        g_theRenderDevice               = &nullDevice;
+        {
+            std::vector<Vertex_PCU>   cubeVerts;
+            std::vector<unsigned int> cubeIndexes;
+            AddVertsForIndexedCube3D(cubeVerts, cubeIndexes, Rgba8::WHITE);
+
+            EntityMeshRenderer renderer;
+            renderer.RegisterMesh(cubeVerts, cubeIndexes);
+            renderer.RegisterMesh(cubeVerts, cubeIndexes);
+            Frustum frustum = Frustum::MakePerspective(Vec3(), EulerAngles(), Player::CAMERA_ASPECT, Player::CAMERA_FOV_DEGREES, Player::CAMERA_NEAR_DISTANCE,
+                                                       Player::CAMERA_FAR_DISTANCE);
+
+            double sequentialMs = 0.0;
+            {
+                EntityStore        entities;
+                RenderCommandQueue queue;
+                SpawnEntities(entities, benchmarkEntities, 2);
+                auto start = Clock::now();
+                for (int frame = 0; frame < FRAME_COUNT; ++frame)
+                {
+                    entities.Integrate(FRAME_SECONDS);
+                    entities.UpdateWorldTransforms();
+                    renderer.SubmitTo(queue, entities, &frustum);
+                    queue.Flush(nullDevice);
+                }
+                sequentialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+            }
+
+            for (int snapshotCount = RenderPipeline::MIN_SNAPSHOT_COUNT; snapshotCount <= RenderPipeline::MAX_SNAPSHOT_COUNT; ++snapshotCount)
+            {
+                EntityStore entities;
+                SpawnEntities(entities, benchmarkEntities, 2);
+                int            presentedInstances = 0;
+                RenderPipeline pipeline([&renderer](RenderSnapshot& snapshot)
+                {
+                    snapshot.m_worldQueue.Clear();
+                    renderer.SubmitInstances(snapshot.m_worldQueue, snapshot.m_meshInstances, &snapshot.m_viewFrustum);
+                    snapshot.m_worldQueue.Sort();
+                }, snapshotCount);
+
+                auto start = Clock::now();
+                for (int frame = 0; frame < FRAME_COUNT; ++frame)
+                {
+                    entities.Integrate(FRAME_SECONDS);
+                    entities.UpdateWorldTransforms();
+
+                    RenderSnapshot& snapshot = pipeline.BeginCapture();
+                    snapshot.m_hasWorld      = true;
+                    snapshot.m_viewFrustum   = frustum;
+                    renderer.GatherInstances(entities, snapshot.m_meshInstances);
+                    pipeline.EndCapture();
+
+                    if (RenderSnapshot* presented = pipeline.AcquirePrepared())
+                    {
+                        for (const std::vector<MeshInstance>& instances : presented->m_meshInstances)
+                        {
+                            presentedInstances += static_cast<int>(instances.size());
+                        }
+                        presented->m_worldQueue.Flush(nullDevice);
+                        pipeline.ReleasePrepared();
+                    }
+                }
+                double pipelinedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+                pipeline.Discard();
+
+                LogInfo("App", "%d entities, %d snapshots: sequential %7.3f ms/frame, pipelined %7.3f ms/frame (%d instances presented)", benchmarkEntities,
+                        snapshotCount, sequentialMs, pipelinedMs, presentedInstances);
+            }
+        }
+        g_theRenderDevice = previousDevice;
+    }
+
+    LogInfo("App", "=== Render Pipeline Test Complete ===");
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks that a RenderPipeline presents snapshots in capture order and N - 1 frames behind for
+// double and triple buffering. When benchmarkEntities > 0, also times frames of simulating that
+// many entities plus world pass preparation run in sequence against the same frames with
+// preparation on the render thread.
+void RunTest_RenderPipeline(int benchmarkEntities);
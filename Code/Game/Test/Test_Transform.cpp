@@ -0,0 +1,114 @@
+#include "Test_Transform.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Transform.hpp"
+
+namespace
+{
+    bool IsNear(const Vec3& a, const Vec3& b)
+    {
+        Vec3 delta = a - b;
+        return delta.x * delta.x + delta.y * delta.y + delta.z * delta.z < 1e-6f;
+    }
+}
+
+void RunTest_Transform()
+{
+    using namespace enigma::core;
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr int ROOT_COUNT      = 1000;
+    constexpr int CHILDREN_PER    = 9;
+    constexpr int MOVERS_PER_TICK = 10;
+    constexpr int FRAME_COUNT     = 200;
+
+    LogInfo("App", "=== Transform Cache Test Starting ===");
+
+    // Correctness: caching, unchanged setters and propagation through two levels
+    Transform root;
+    Transform child;
+    Transform grandchild;
+    child.SetParent(&root);
+    grandchild.SetParent(&child);
+    child.SetPosition(Vec3(1, 0, 0));
+    grandchild.SetPosition(Vec3(0, 1, 0));
+    root.SetPosition(Vec3(10, 0, 0));
+
+    bool     passed  = IsNear(grandchild.GetLocalToWorldMatrix().TransformPosition3D(Vec3()), Vec3(11, 1, 0));
+    uint32_t version = grandchild.GetWorldVersion();
+    grandchild.GetLocalToWorldMatrix();
+    root.SetPosition(Vec3(10, 0, 0)); // Same value, must not dirty anything
+    grandchild.GetLocalToWorldMatrix();
+    passed = passed && grandchild.GetWorldVersion() == version;
+
+    root.SetOrientation(EulerAngles(90.f, 0.f, 0.f)); // Yaw: +X maps to +Y
+    passed = passed && IsNear(grandchild.GetLocalToWorldMatrix().TransformPosition3D(Vec3()), Vec3(9, 1, 0));
+    child.SetParent(nullptr);
+    passed = passed && IsNear(grandchild.GetLocalToWorldMatrix().TransformPosition3D(Vec3()), Vec3(1, 1, 0));
+    LogInfo("App", "Dirty flags and propagation: %s", passed ? "PASSED" : "FAILED");
+
+    // Cycles: a transform can't become its own parent or the child of one of its descendants
+    passed = !child.SetParent(&grandchild) && !child.SetParent(&child) && !root.SetParent(&root);
+    passed = passed && child.GetParent() == nullptr && grandchild.GetParent() == &child && child.GetChildCount() == 1;
+    passed = passed && grandchild.SetParent(&root) && child.SetParent(&grandchild) && child.GetParent() == &grandchild;
+    passed = passed && IsNear(child.GetLocalToWorldMatrix().TransformPosition3D(Vec3()), grandchild.GetLocalToWorldMatrix().TransformPosition3D(Vec3(1, 0, 0)));
+    LogInfo("App", "Parent cycles rejected: %s", passed ? "PASSED" : "FAILED");
+
+    // Throughput: roots with children, a handful of roots move per frame, every world matrix is read
+    std::vector<std::unique_ptr<Transform>> nodes;
+    nodes.reserve(ROOT_COUNT * (CHILDREN_PER + 1));
+    for (int rootIndex = 0; rootIndex < ROOT_COUNT; ++rootIndex)
+    {
+        nodes.push_back(std::make_unique<Transform>());
+        Transform* parent = nodes.back().get();
+        parent->SetPosition(Vec3(static_cast<float>(rootIndex), 0, 0));
+        for (int childIndex = 0; childIndex < CHILDREN_PER; ++childIndex)
+        {
+            nodes.push_back(std::make_unique<Transform>());
+            nodes.back()->SetParent(parent);
+            nodes.back()->SetPosition(Vec3(0, static_cast<float>(childIndex), 0));
+        }
+    }
+
+    float checksum = 0.f;
+    auto  start    = Clock::now();
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        for (int mover = 0; mover < MOVERS_PER_TICK; ++mover)
+        {
+            Transform& moving = *nodes[static_cast<size_t>((frame * MOVERS_PER_TICK + mover) % ROOT_COUNT) * (CHILDREN_PER + 1)];
+            moving.SetOrientation(EulerAngles(static_cast<float>(frame), 0.f, 0.f));
+        }
+        for (const std::unique_ptr<Transform>& node : nodes)
+        {
+            checksum += node->GetLocalToWorldMatrix().TransformPosition3D(Vec3()).x;
+        }
+    }
+    double cachedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+
+    // Baseline: what the old per-call rebuild cost, every node every frame
+    start = Clock::now();
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        for (const std::unique_ptr<Transform>& node : nodes)
+        {
+            Mat44 rebuilt = Mat44::MakeTranslation3D(node->GetPosition());
+            rebuilt.Append(node->GetOrientation().GetAsMatrix_IFwd_JLeft_KUp());
+            rebuilt.Append(Mat44::MakeNonUniformScale3D(node->GetScale()));
+            checksum += rebuilt.TransformPosition3D(Vec3()).x;
+        }
+    }
+    double rebuildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+
+    LogInfo("App", "%zu nodes, %d moving roots per frame: cached %.3f ms, rebuild every call %.3f ms (checksum %.1f)", nodes.size(), MOVERS_PER_TICK, cachedMs, rebuildMs,
+            static_cast<double>(checksum));
+
+    LogInfo("App", "=== Transform Cache Test Complete ===");
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Checks Transform's dirty flags, parent/child propagation and that parent cycles are rejected,
+// then times reading the world matrices of a large hierarchy when only a few nodes move per frame.
+void RunTest_Transform();
@@ -0,0 +1,136 @@
+#include "Transform.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    bool AreEqual(const EulerAngles& a, const EulerAngles& b)
+    {
+        return a.m_yawDegrees == b.m_yawDegrees && a.m_pitchDegrees == b.m_pitchDegrees && a.m_rollDegrees == b.m_rollDegrees;
+    }
+
+    bool AreEqual(const Vec3& a, const Vec3& b)
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+}
+
+Transform::~Transform()
+{
+    SetParent(nullptr);
+    for (Transform* child : m_children)
+    {
+        child->m_parent = nullptr;
+        child->MarkWorldDirty();
+    }
+}
+
+void Transform::SetPosition(const Vec3& position)
+{
+    if (!AreEqual(position, m_position))
+    {
+        m_position = position;
+        MarkLocalDirty();
+    }
+}
+
+void Transform::SetOrientation(const EulerAngles& orientation)
+{
+    if (!AreEqual(orientation, m_orientation))
+    {
+        m_orientation = orientation;
+        MarkLocalDirty();
+    }
+}
+
+void Transform::SetScale(const Vec3& scale)
+{
+    if (!AreEqual(scale, m_scale))
+    {
+        m_scale = scale;
+        MarkLocalDirty();
+    }
+}
+
+void Transform::Translate(const Vec3& offset)
+{
+    SetPosition(m_position + offset);
+}
+
+bool Transform::SetParent(Transform* parent)
+{
+    if (parent == m_parent)
+    {
+        return true;
+    }
+    // A cycle would make MarkWorldDirty and the world matrix rebuild recurse forever
+    for (const Transform* ancestor = parent; ancestor; ancestor = ancestor->m_parent)
+    {
+        if (ancestor == this)
+        {
+            return false;
+        }
+    }
+    if (m_parent)
+    {
+        std::vector<Transform*>& siblings = m_parent->m_children;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+    m_parent = parent;
+    if (m_parent)
+    {
+        m_parent->m_children.push_back(this);
+    }
+    MarkWorldDirty();
+    return true;
+}
+
+const Mat44& Transform::GetLocalToParentMatrix() const
+{
+    if (m_isLocalDirty)
+    {
+        m_localToParent = Mat44::MakeTranslation3D(m_position);
+        m_localToParent.Append(m_orientation.GetAsMatrix_IFwd_JLeft_KUp());
+        m_localToParent.Append(Mat44::MakeNonUniformScale3D(m_scale));
+        m_isLocalDirty = false;
+    }
+    return m_localToParent;
+}
+
+const Mat44& Transform::GetLocalToWorldMatrix() const
+{
+    if (m_isWorldDirty)
+    {
+        if (m_parent)
+        {
+            m_localToWorld = m_parent->GetLocalToWorldMatrix();
+            m_localToWorld.Append(GetLocalToParentMatrix());
+        }
+        else
+        {
+            m_localToWorld = GetLocalToParentMatrix();
+        }
+        m_isWorldDirty = false;
+        ++m_worldVersion;
+    }
+    return m_localToWorld;
+}
+
+void Transform::MarkLocalDirty()
+{
+    m_isLocalDirty = true;
+    MarkWorldDirty();
+}
+
+void Transform::MarkWorldDirty()
+{
+    if (m_isWorldDirty)
+    {
+        return; // Descendants were flagged when this node was, and none has been read since
+    }
+    m_isWorldDirty = true;
+    for (Transform* child : m_children)
+    {
+        child->MarkWorldDirty();
+    }
+}
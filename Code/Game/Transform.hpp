@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+//-----------------------------------------------------------------------------------------------
+// Position, orientation and scale with cached local and world matrices. Setters mark the local
+// matrix dirty (setting an unchanged value does nothing) and flag the world matrix of this node
+// and its descendants; the matrices are rebuilt lazily the next time they are read. Reading an
+// unchanged transform returns the cached matrix.
+//
+// Attachment is by pointer and does not own: a parent keeps a list of its children so dirtiness
+// can be pushed down, and each side detaches from the other on destruction. Marking stops at
+// children that are already dirty, so repeated edits in one frame walk a subtree at most once.
+//
+class Transform
+{
+public:
+    Transform() = default;
+    ~Transform();
+    Transform(const Transform&)            = delete;
+    Transform& operator=(const Transform&) = delete;
+
+    const Vec3&        GetPosition() const { return m_position; }
+    const EulerAngles& GetOrientation() const { return m_orientation; }
+    const Vec3&        GetScale() const { return m_scale; }
+
+    void SetPosition(const Vec3& position);
+    void SetOrientation(const EulerAngles& orientation);
+    void SetScale(const Vec3& scale);
+    void Translate(const Vec3& offset);
+
+    /// Local values are kept, so the child's world placement changes with the new parent.
+    /// Returns false and changes nothing if the parent is this transform or one of its descendants.
+    bool       SetParent(Transform* parent);
+    Transform* GetParent() const { return m_parent; }
+    int        GetChildCount() const { return static_cast<int>(m_children.size()); }
+
+    const Mat44& GetLocalToParentMatrix() const;
+    const Mat44& GetLocalToWorldMatrix() const;
+
+    /// Bumped every time the world matrix is rebuilt, for caches derived from it
+    uint32_t GetWorldVersion() const { return m_worldVersion; }
+
+private:
+    void MarkLocalDirty();
+    void MarkWorldDirty();
+
+    Vec3        m_position;
+    EulerAngles m_orientation;
+    Vec3        m_scale = Vec3(1, 1, 1);
+
+    Transform*              m_parent = nullptr;
+    std::vector<Transform*> m_children;
+
+    mutable Mat44    m_localToParent;
+    mutable Mat44    m_localToWorld;
+    mutable uint32_t m_worldVersion = 0;
+    mutable bool     m_isLocalDirty = true;
+    mutable bool     m_isWorldDirty = true;
+};